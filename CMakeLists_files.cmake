@@ -38,6 +38,8 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/flow/countGlobalCells.cpp
   opm/simulators/flow/KeywordValidation.cpp
   opm/simulators/flow/SimulatorFullyImplicitBlackoilEbos.cpp
+  opm/simulators/linalg/bda/BlockedMatrix.cpp
+  opm/simulators/linalg/bda/Reorder.cpp
   opm/simulators/linalg/ExtractParallelGridInformationToISTL.cpp
   opm/simulators/linalg/FlexibleSolver1.cpp
   opm/simulators/linalg/FlexibleSolver2.cpp
@@ -55,6 +57,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/timestepping/SimulatorTimerInterface.cpp
   opm/simulators/timestepping/gatherConvergenceReport.cpp
   opm/simulators/utils/DeferredLogger.cpp
+  opm/simulators/utils/DistributedRestart.cpp
   opm/simulators/utils/gatherDeferredLogger.cpp
   opm/simulators/utils/ParallelFileMerger.cpp
   opm/simulators/utils/ParallelRestart.cpp
@@ -65,6 +68,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/wells/GasLiftStage2.cpp
   opm/simulators/wells/GlobalWellInfo.cpp
   opm/simulators/wells/GroupState.cpp
+  opm/simulators/wells/GroupTree.cpp
   opm/simulators/wells/MultisegmentWellEval.cpp
   opm/simulators/wells/MultisegmentWellGeneric.cpp
   opm/simulators/wells/ParallelWellInfo.cpp
@@ -94,9 +98,7 @@ if(CUDA_FOUND)
   list (APPEND MAIN_SOURCE_FILES opm/simulators/linalg/bda/BdaBridge.cpp)
 endif()
 if(OPENCL_FOUND)
-  list (APPEND MAIN_SOURCE_FILES opm/simulators/linalg/bda/BlockedMatrix.cpp)
   list (APPEND MAIN_SOURCE_FILES opm/simulators/linalg/bda/BILU0.cpp)
-  list (APPEND MAIN_SOURCE_FILES opm/simulators/linalg/bda/Reorder.cpp)
   list (APPEND MAIN_SOURCE_FILES opm/simulators/linalg/bda/ChowPatelIlu.cpp)
   list (APPEND MAIN_SOURCE_FILES opm/simulators/linalg/bda/opencl.cpp)
   list (APPEND MAIN_SOURCE_FILES opm/simulators/linalg/bda/openclKernels.cpp)
@@ -133,6 +135,7 @@ endif()
 list (APPEND TEST_SOURCE_FILES
   tests/test_equil.cc
   tests/test_ecl_output.cc
+  tests/test_ecloutputqueue.cpp
   tests/test_blackoil_amg.cpp
   tests/test_convergencereport.cpp
   tests/test_flexiblesolver.cpp
@@ -143,6 +146,8 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_multmatrixtransposed.cpp
   tests/test_wellmodel.cpp
   tests/test_deferredlogger.cpp
+  tests/test_threadedforeach.cpp
+  tests/test_distributedrestart.cpp
   tests/test_timer.cpp
   tests/test_invert.cpp
   tests/test_stoppedwells.cpp
@@ -150,8 +155,11 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_norne_pvt.cpp
   tests/test_wellprodindexcalculator.cpp
   tests/test_wellstate.cpp
+  tests/test_standardwellcontributions.cpp
+  tests/test_segmenttreesolver.cpp
   tests/test_parallelwellinfo.cpp
   tests/test_glift1.cpp
+  tests/test_threadedwellassembly.cpp
   tests/test_keyword_validator.cpp
   tests/test_GroupState.cpp
   tests/test_ALQState.cpp
@@ -235,6 +243,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/timestepping/SimulatorReport.hpp
   opm/simulators/wells/SegmentState.hpp
   opm/simulators/wells/WellContainer.hpp
+  opm/simulators/wells/WellPhaseContainer.hpp
   opm/simulators/aquifers/AquiferInterface.hpp
   opm/simulators/aquifers/AquiferCarterTracy.hpp
   opm/simulators/aquifers/AquiferFetkovich.hpp
@@ -263,6 +272,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/bda/WellContributions.hpp
   opm/simulators/linalg/amgcpr.hh
   opm/simulators/linalg/twolevelmethodcpr.hh
+  opm/simulators/linalg/BinaryLinearSystem.hpp
   opm/simulators/linalg/ExtractParallelGridInformationToISTL.hpp
   opm/simulators/linalg/FlexibleSolver.hpp
   opm/simulators/linalg/FlexibleSolver_impl.hpp
@@ -272,9 +282,11 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/ISTLSolverEbosFlexible.hpp
   opm/simulators/linalg/MatrixBlock.hpp
   opm/simulators/linalg/MatrixMarketSpecializations.hpp
+  opm/simulators/linalg/MixedPrecisionPreconditioner.hpp
   opm/simulators/linalg/OwningBlockPreconditioner.hpp
   opm/simulators/linalg/OwningTwoLevelPreconditioner.hpp
   opm/simulators/linalg/ParallelOverlappingILU0.hpp
+  opm/simulators/linalg/PipelinedBiCGSTABSolver.hpp
   opm/simulators/linalg/ParallelRestrictedAdditiveSchwarz.hpp
   opm/simulators/linalg/ParallelIstlInformation.hpp
   opm/simulators/linalg/PressureSolverPolicy.hpp
@@ -282,6 +294,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/PreconditionerFactory.hpp
   opm/simulators/linalg/PreconditionerWithUpdate.hpp
   opm/simulators/linalg/PropertyTree.hpp
+  opm/simulators/linalg/RecyclingGCRSolver.hpp
   opm/simulators/linalg/WellOperators.hpp
   opm/simulators/linalg/WriteSystemMatrixHelper.hpp
   opm/simulators/linalg/findOverlapRowsAndColumns.hpp
@@ -298,7 +311,9 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/utils/ParallelFileMerger.hpp
   opm/simulators/utils/DeferredLoggingErrorHelpers.hpp
   opm/simulators/utils/DeferredLogger.hpp
+  opm/simulators/utils/DistributedRestart.hpp
   opm/simulators/utils/gatherDeferredLogger.hpp
+  opm/simulators/utils/threadedForEach.hpp
   opm/simulators/utils/moduleVersion.hpp
   opm/simulators/utils/ParallelEclipseState.hpp
   opm/simulators/utils/ParallelRestart.hpp
@@ -312,6 +327,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/wells/WellState.hpp
   opm/simulators/wells/GlobalWellInfo.hpp
   opm/simulators/wells/GroupState.hpp
+  opm/simulators/wells/GroupTree.hpp
   opm/simulators/wells/ALQState.hpp
   opm/simulators/wells/WGState.hpp
   opm/simulators/wells/VFPProperties.hpp
@@ -325,14 +341,17 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/wells/WellProdIndexCalculator.hpp
   opm/simulators/wells/StandardWell.hpp
   opm/simulators/wells/StandardWell_impl.hpp
+  opm/simulators/wells/StandardWellContributions.hpp
   opm/simulators/wells/MultisegmentWell.hpp
   opm/simulators/wells/MultisegmentWell_impl.hpp
   opm/simulators/wells/MSWellHelpers.hpp
+  opm/simulators/wells/SegmentTreeSolver.hpp
   opm/simulators/wells/BlackoilWellModel.hpp
   opm/simulators/wells/BlackoilWellModel_impl.hpp
   opm/simulators/wells/ParallelWellInfo.hpp
   )
 
 list (APPEND EXAMPLE_SOURCE_FILES
+  examples/mergedrst.cpp
   examples/printvfp.cpp
   )
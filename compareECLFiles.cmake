@@ -142,6 +142,86 @@ function(add_test_compare_parallel_simulation)
 endfunction()
 
 
+###########################################################################
+# TEST: add_test_compare_threaded_simulation
+###########################################################################
+
+# Input:
+#   - casename: basename (no extension)
+#   - threads: number of OpenMP threads used for the threaded run
+#
+# Details:
+#   - This test class compares the output from a simulation using several
+#     threads per process to the output from a single threaded run of the
+#     same model and reports the wall times of both runs.
+function(add_test_compare_threaded_simulation)
+  set(oneValueArgs CASENAME FILENAME SIMULATOR ABS_TOL REL_TOL DIR THREADS)
+  set(multiValueArgs TEST_ARGS)
+  cmake_parse_arguments(PARAM "$" "${oneValueArgs}" "${multiValueArgs}" ${ARGN} )
+
+  if(NOT PARAM_DIR)
+    set(PARAM_DIR ${PARAM_CASENAME})
+  endif()
+  if(NOT PARAM_THREADS)
+    set(PARAM_THREADS 4)
+  endif()
+
+  set(RESULT_PATH ${BASE_RESULT_PATH}/threaded/${PARAM_SIMULATOR}+${PARAM_CASENAME})
+  set(TEST_ARGS ${OPM_TESTS_ROOT}/${PARAM_DIR}/${PARAM_FILENAME} ${PARAM_TEST_ARGS})
+
+  opm_add_test(compareThreadedSim_${PARAM_SIMULATOR}+${PARAM_FILENAME} NO_COMPILE
+               EXE_NAME ${PARAM_SIMULATOR}
+               DRIVER_ARGS ${OPM_TESTS_ROOT}/${PARAM_DIR} ${RESULT_PATH}
+                           ${PROJECT_BINARY_DIR}/bin
+                           ${PARAM_FILENAME}
+                           ${PARAM_ABS_TOL} ${PARAM_REL_TOL}
+                           ${COMPARE_ECL_COMMAND}
+                           ${PARAM_THREADS}
+               TEST_ARGS ${TEST_ARGS})
+  set_tests_properties(compareThreadedSim_${PARAM_SIMULATOR}+${PARAM_FILENAME}
+                       PROPERTIES RUN_SERIAL 1)
+endfunction()
+
+###########################################################################
+# TEST: add_test_strong_scaling
+###########################################################################
+
+# Input:
+#   - casename: basename (no extension)
+#   - ranks: list of MPI process counts
+#
+# Details:
+#   - This benchmark runs a model for each number of MPI processes, with
+#     the standard and the pipelined BiCGStab solver, and reports the
+#     wall times and linear solve times.
+function(add_test_strong_scaling)
+  set(oneValueArgs CASENAME FILENAME SIMULATOR DIR SOLVER_CONFIG)
+  set(multiValueArgs TEST_ARGS RANKS)
+  cmake_parse_arguments(PARAM "$" "${oneValueArgs}" "${multiValueArgs}" ${ARGN} )
+
+  if(NOT PARAM_DIR)
+    set(PARAM_DIR ${PARAM_CASENAME})
+  endif()
+  if(NOT PARAM_SOLVER_CONFIG)
+    set(PARAM_SOLVER_CONFIG ${PROJECT_SOURCE_DIR}/tests/options_cpr_pipelined.json)
+  endif()
+  string(REPLACE ";" "," RANKS "${PARAM_RANKS}")
+
+  set(RESULT_PATH ${BASE_RESULT_PATH}/scaling/${PARAM_SIMULATOR}+${PARAM_CASENAME})
+  set(TEST_ARGS ${OPM_TESTS_ROOT}/${PARAM_DIR}/${PARAM_FILENAME} ${PARAM_TEST_ARGS})
+
+  opm_add_test(strongScaling_${PARAM_SIMULATOR}+${PARAM_FILENAME} NO_COMPILE
+               EXE_NAME ${PARAM_SIMULATOR}
+               DRIVER_ARGS ${OPM_TESTS_ROOT}/${PARAM_DIR} ${RESULT_PATH}
+                           ${PROJECT_BINARY_DIR}/bin
+                           ${PARAM_FILENAME}
+                           ${PARAM_SOLVER_CONFIG}
+                           ${RANKS}
+               TEST_ARGS ${TEST_ARGS})
+  set_tests_properties(strongScaling_${PARAM_SIMULATOR}+${PARAM_FILENAME}
+                       PROPERTIES RUN_SERIAL 1)
+endfunction()
+
 ###########################################################################
 # TEST: add_test_compare_parallel_restarted_simulation
 ###########################################################################
@@ -1152,3 +1232,46 @@ endif()
                                        DIR udq_actionx
                                        TEST_ARGS --linear-solver-reduction=1e-7 --tolerance-cnv=5e-6 --tolerance-mb=1e-6)
 endif()
+
+if(OPENMP_FOUND OR OpenMP_FOUND)
+  opm_set_test_driver(${PROJECT_SOURCE_DIR}/tests/run-threaded-regressionTest.sh "")
+
+  # The threaded linearization only changes the order in which the element
+  # contributions are accumulated, so we can use the tolerances of the MPI tests.
+  set(abs_tol_threaded 0.02)
+  set(rel_tol_threaded 8e-5)
+
+  add_test_compare_threaded_simulation(CASENAME spe1
+                                       FILENAME SPE1CASE2
+                                       SIMULATOR flow
+                                       ABS_TOL ${abs_tol_threaded}
+                                       REL_TOL ${rel_tol_threaded}
+                                       THREADS 4
+                                       TEST_ARGS --linear-solver-reduction=1e-7 --tolerance-cnv=5e-6 --tolerance-mb=1e-8)
+
+  add_test_compare_threaded_simulation(CASENAME spe9
+                                       FILENAME SPE9_CP_SHORT
+                                       SIMULATOR flow
+                                       ABS_TOL ${abs_tol_threaded}
+                                       REL_TOL ${rel_tol_threaded}
+                                       THREADS 4
+                                       TEST_ARGS --linear-solver-reduction=1e-7 --tolerance-cnv=5e-6 --tolerance-mb=1e-8)
+
+  add_test_compare_threaded_simulation(CASENAME norne
+                                       FILENAME NORNE_ATW2013
+                                       SIMULATOR flow
+                                       ABS_TOL ${abs_tol_threaded}
+                                       REL_TOL ${coarse_rel_tol}
+                                       THREADS 8)
+endif()
+
+# Strong scaling benchmark of the pipelined BiCGStab solver. Enabled by
+# giving the process counts, e.g. -DOPM_STRONG_SCALING_RANKS="1;4;16;64".
+if(MPI_FOUND AND OPM_STRONG_SCALING_RANKS)
+  opm_set_test_driver(${PROJECT_SOURCE_DIR}/tests/run-strong-scaling-benchmark.sh "")
+
+  add_test_strong_scaling(CASENAME norne
+                          FILENAME NORNE_ATW2013
+                          SIMULATOR flow
+                          RANKS ${OPM_STRONG_SCALING_RANKS})
+endif()
@@ -716,6 +716,35 @@ private:
 };
 
 
+// Packs the data of several handles into a single message per rank, such
+// that all of them are exchanged in one round of communication. The
+// handles must be unpacked in the order they were packed in, which is the
+// order they are given in.
+class PackUnPackCollection : public P2PCommunicatorType::DataHandleInterface
+{
+    std::vector<P2PCommunicatorType::DataHandleInterface*> handles_;
+
+public:
+    explicit PackUnPackCollection(std::vector<P2PCommunicatorType::DataHandleInterface*> handles)
+        : handles_(std::move(handles))
+    { }
+
+    // pack all data associated with link
+    void pack(int link, MessageBufferType& buffer)
+    {
+        for (auto* handle : handles_)
+            handle->pack(link, buffer);
+    }
+
+    // unpack all data associated with link
+    void unpack(int link, MessageBufferType& buffer)
+    {
+        for (auto* handle : handles_)
+            handle->unpack(link, buffer);
+    }
+};
+
+
 template <class Grid, class EquilGrid, class GridView>
 CollectDataToIORank<Grid,EquilGrid,GridView>::
 CollectDataToIORank(const Grid& grid, const EquilGrid* equilGrid,
@@ -900,12 +929,17 @@ collect(const data::Solution& localCellData,
                 this->isIORank()
     };
 
-    toIORankComm_.exchange(packUnpackCellData);
-    toIORankComm_.exchange(packUnpackWellData);
-    toIORankComm_.exchange(packUnpackGroupAndNetworkData);
-    toIORankComm_.exchange(packUnpackBlockData);
-    toIORankComm_.exchange(packUnpackWBPData);
-    toIORankComm_.exchange(packUnpackAquiferData);
+    // send everything in one message per rank instead of one per category
+    PackUnPackCollection packUnpackAll {{
+        &packUnpackCellData,
+        &packUnpackWellData,
+        &packUnpackGroupAndNetworkData,
+        &packUnpackBlockData,
+        &packUnpackWBPData,
+        &packUnpackAquiferData
+    }};
+
+    toIORankComm_.exchange(packUnpackAll);
 
 #ifndef NDEBUG
     // make sure every process is on the same page
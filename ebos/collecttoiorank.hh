@@ -63,7 +63,9 @@ public:
                         const Dune::CartesianIndexMapper<Grid>& cartMapper,
                         const Dune::CartesianIndexMapper<EquilGrid>* equilCartMapper);
 
-    // gather solution to rank 0 for EclipseWriter
+    // gather solution to rank 0 for EclipseWriter. All the data is sent
+    // in a single message per rank, so empty arguments are cheap and should
+    // be used for the data that is not needed by the caller.
     void collect(const data::Solution& localCellData,
                  const std::map<std::pair<std::string, int>, double>& localBlockData,
                  const std::map<std::size_t, double>& localWBPData,
@@ -89,6 +91,20 @@ public:
     const data::Aquifers& globalAquiferData() const
     { return globalAquiferData_; }
 
+    // Move the gathered restart data out of the collector, e.g. to hand it
+    // over to the output thread. Only valid until the next call to collect().
+    data::Solution releaseGlobalCellData()
+    { return std::move(globalCellData_); }
+
+    data::Wells releaseGlobalWellData()
+    { return std::move(globalWellData_); }
+
+    data::GroupAndNetworkValues releaseGlobalGroupAndNetworkData()
+    { return std::move(globalGroupAndNetworkData_); }
+
+    data::Aquifers releaseGlobalAquiferData()
+    { return std::move(globalAquiferData_); }
+
     bool isIORank() const
     { return toIORankComm_.rank() == ioRank; }
 
@@ -36,11 +36,13 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 #include <opm/parser/eclipse/Units/Units.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <initializer_list>
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 namespace {
 
@@ -554,7 +556,7 @@ assignToSolution(data::Solution& sol)
     using DataEntry = std::tuple<std::string,
                                  UnitSystem::measure,
                                  data::TargetType,
-                                 const std::vector<Scalar>&>;
+                                 std::vector<Scalar>&>;
     auto doInsert = [&sol](const DataEntry& entry)
     {
         if (!std::get<3>(entry).empty())
@@ -602,7 +604,7 @@ assignToSolution(data::Solution& sol)
         {"TMULT_RC", UnitSystem::measure::identity,  data::TargetType::RESTART_SOLUTION,      rockCompTransMultiplier_},
         {"WATKR",    UnitSystem::measure::identity,  data::TargetType::RESTART_AUXILIARY,     relativePermeability_[waterPhaseIdx]},
         {"WAT_DEN",  UnitSystem::measure::density,   data::TargetType::RESTART_AUXILIARY,     density_[waterPhaseIdx]},
-        {"WAT_VISC", UnitSystem::measure::viscosity, data::TargetType::RESTART_AUXILIARY,     viscosity_[gasPhaseIdx]}
+        {"WAT_VISC", UnitSystem::measure::viscosity, data::TargetType::RESTART_AUXILIARY,     viscosity_[waterPhaseIdx]}
     };
 
     for (const auto& entry : data)
@@ -705,36 +707,6 @@ setRestart(const data::Solution& sol,
         ppcw_[elemIdx] = sol.data("PPCW")[globalDofIndex];
 }
 
-template<class FluidSystem,class Scalar>
-typename EclGenericOutputBlackoilModule<FluidSystem,Scalar>::ScalarBuffer
-EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-regionSum(const ScalarBuffer& property,
-          const std::vector<int>& regionId,
-          size_t maxNumberOfRegions,
-          const Comm& comm)
-{
-        ScalarBuffer totals(maxNumberOfRegions, 0.0);
-
-        if (property.empty())
-            return totals;
-
-        assert(regionId.size() == property.size());
-        for (size_t j = 0; j < regionId.size(); ++j) {
-            const int regionIdx = regionId[j] - 1;
-            // the cell is not attributed to any region. ignore it!
-            if (regionIdx < 0)
-                continue;
-
-            assert(regionIdx < static_cast<int>(maxNumberOfRegions));
-            totals[regionIdx] += property[j];
-        }
-
-        for (size_t i = 0; i < maxNumberOfRegions; ++i)
-            totals[i] = comm.sum(totals[i]);
-
-        return totals;
-    }
-
 template<class FluidSystem, class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 doAllocBuffers(unsigned bufferSize,
@@ -744,8 +716,11 @@ doAllocBuffers(unsigned bufferSize,
                const bool isRestart,
                const bool vapparsActive,
                const bool enableHysteresis,
-               unsigned numTracers)
+               unsigned numTracers,
+               const bool summaryOnly)
 {
+    this->releaseFieldBuffers_();
+
     // Only output RESTART_AUXILIARY asked for by the user.
     std::map<std::string, int> rstKeywords = schedule_.rst_keywords(reportStepNum);
     for (auto& [keyword, should_write] : rstKeywords) {
@@ -829,7 +804,8 @@ doAllocBuffers(unsigned bufferSize,
     // 1) when we want to restart
     // 2) when it is ask for by the user via restartConfig
     // 3) when it is not a substep
-    if (!isRestart && (!schedule_.write_rst_file(reportStepNum) || substep))
+    // 4) when it is not only the summary which is evaluated
+    if (!isRestart && (!schedule_.write_rst_file(reportStepNum) || substep || summaryOnly))
         return;
 
     // always output saturation of active phases
@@ -1007,6 +983,36 @@ doAllocBuffers(unsigned bufferSize,
 
 }
 
+template<class FluidSystem, class Scalar>
+void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
+releaseFieldBuffers_()
+{
+    // assigning an empty buffer also gives the memory back
+    auto release = [](ScalarBuffer& buffer) { buffer = ScalarBuffer{}; };
+
+    for (auto* buffer : {&oilPressure_, &temperature_, &rs_, &rv_, &overburdenPressure_,
+                         &oilSaturationPressure_, &sSol_, &cPolymer_, &cFoam_, &cSalt_,
+                         &extboX_, &extboY_, &extboZ_, &mFracOil_, &mFracGas_, &mFracCo2_,
+                         &soMax_, &pcSwMdcOw_, &krnSwMdcOw_, &pcSwMdcGo_, &krnSwMdcGo_, &ppcw_,
+                         &gasDissolutionFactor_, &oilVaporizationFactor_, &bubblePointPressure_,
+                         &dewPointPressure_, &rockCompPorvMultiplier_, &swMax_,
+                         &minimumOilPressure_, &saturatedOilFormationVolumeFactor_,
+                         &rockCompTransMultiplier_, &gasFormationVolumeFactor_})
+    {
+        release(*buffer);
+    }
+
+    for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+        release(saturation_[phaseIdx]);
+        release(invB_[phaseIdx]);
+        release(density_[phaseIdx]);
+        release(viscosity_[phaseIdx]);
+        release(relativePermeability_[phaseIdx]);
+    }
+
+    tracerConcentrations_.clear();
+}
+
 template<class FluidSystem, class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 fipUnitConvert_(std::unordered_map<Inplace::Phase, Scalar>& fip) const
@@ -1399,15 +1405,6 @@ outputFipLogImpl(const Inplace& inplace) const
     }
 }
 
-template<class FluidSystem,class Scalar>
-int EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-regionMax(const std::vector<int>& region,
-          const Comm& comm)
-{
-    const auto max_value = region.empty() ? 0 : *std::max_element(region.begin(), region.end());
-    return comm.max(max_value);
-}
-
 template<class FluidSystem,class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 update(Inplace& inplace,
@@ -1426,51 +1423,78 @@ update(Inplace& inplace,
 }
 
 template<class FluidSystem,class Scalar>
-void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-makeRegionSum(Inplace& inplace,
-              const std::string& region_name,
-              const Comm& comm) const
+Inplace EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
+accumulateRegionSums(const Comm& comm)
 {
-    const auto& region = this->regions_.at(region_name);
-    const std::size_t ntFip = this->regionMax(region, comm);
-
-    auto update_inplace =
-        [&inplace, &region, &region_name, &comm, ntFip, this]
-        (const Inplace::Phase       phase,
-         const std::vector<Scalar>& value)
-    {
-        update(inplace, region_name, phase, ntFip,
-               this->regionSum(value, region, ntFip, comm));
+    // The quantities summed over the regions, in the order they are stored
+    // for every region. An empty buffer sums to zero.
+    std::vector<std::pair<Inplace::Phase, const ScalarBuffer*>> properties {
+        {Inplace::Phase::PressurePV, &this->pressureTimesPoreVolume_},
+        {Inplace::Phase::HydroCarbonPV, &this->hydrocarbonPoreVolume_},
+        {Inplace::Phase::PressureHydroCarbonPV, &this->pressureTimesHydrocarbonVolume_},
+        {Inplace::Phase::DynamicPoreVolume, &this->dynamicPoreVolume_}
     };
-
-    update_inplace(Inplace::Phase::PressurePV,
-                   this->pressureTimesPoreVolume_);
-
-    update_inplace(Inplace::Phase::HydroCarbonPV,
-                   this->hydrocarbonPoreVolume_);
-
-    update_inplace(Inplace::Phase::PressureHydroCarbonPV,
-                   this->pressureTimesHydrocarbonVolume_);
-
-    update_inplace(Inplace::Phase::DynamicPoreVolume,
-                   this->dynamicPoreVolume_);
-
     for (const auto& phase : Inplace::phases()) {
         auto fipPos = this->fip_.find(phase);
-        if (fipPos != this->fip_.end()) {
-            update_inplace(phase, fipPos->second);
+        if (fipPos != this->fip_.end())
+            properties.emplace_back(phase, &fipPos->second);
+    }
+    const std::size_t numProperties = properties.size();
+
+    std::vector<const std::string*> regionNames;
+    std::vector<const std::vector<int>*> regionIds;
+    std::vector<int> numRegions;
+    for (const auto& [name, region] : this->regions_) {
+        regionNames.push_back(&name);
+        regionIds.push_back(&region);
+        numRegions.push_back(region.empty() ? 0 : *std::max_element(region.begin(), region.end()));
+    }
+    if (!numRegions.empty())
+        comm.max(numRegions.data(), numRegions.size());
+
+    // the sums of region set r are stored from offset[r], region by region
+    std::vector<std::size_t> offset(regionIds.size() + 1, 0);
+    for (std::size_t r = 0; r < regionIds.size(); ++r)
+        offset[r + 1] = offset[r] + numRegions[r] * numProperties;
+
+    // sum all the quantities for all the region sets in one pass over the cells
+    ScalarBuffer totals(offset.back(), 0.0);
+    const std::size_t numCells = regionIds.empty() ? 0 : regionIds.front()->size();
+    std::vector<Scalar> cellValues(numProperties);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        for (std::size_t p = 0; p < numProperties; ++p) {
+            const auto& property = *properties[p].second;
+            assert(property.empty() || property.size() == numCells);
+            cellValues[p] = property.empty() ? 0.0 : property[cellIdx];
+        }
+
+        for (std::size_t r = 0; r < regionIds.size(); ++r) {
+            const int regionIdx = (*regionIds[r])[cellIdx] - 1;
+            // the cell is not attributed to any region. ignore it!
+            if (regionIdx < 0)
+                continue;
+
+            assert(regionIdx < numRegions[r]);
+            auto* regionTotals = &totals[offset[r] + regionIdx * numProperties];
+            for (std::size_t p = 0; p < numProperties; ++p)
+                regionTotals[p] += cellValues[p];
         }
     }
-}
 
-template<class FluidSystem,class Scalar>
-Inplace EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
-accumulateRegionSums(const Comm& comm)
-{
-    Inplace inplace;
+    // a single reduction for everything
+    if (!totals.empty())
+        comm.sum(totals.data(), totals.size());
 
-    for (const auto& region : this->regions_) {
-        makeRegionSum(inplace, region.first, comm);
+    Inplace inplace;
+    for (std::size_t r = 0; r < regionIds.size(); ++r) {
+        const std::size_t ntFip = numRegions[r];
+        ScalarBuffer values(ntFip);
+        for (std::size_t p = 0; p < numProperties; ++p) {
+            for (std::size_t regionIdx = 0; regionIdx < ntFip; ++regionIdx)
+                values[regionIdx] = totals[offset[r] + regionIdx * numProperties + p];
+
+            update(inplace, *regionNames[r], properties[p].first, ntFip, values);
+        }
     }
 
     // The first time the outputFipLog function is run we store the inplace values in
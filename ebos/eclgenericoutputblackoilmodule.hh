@@ -238,7 +238,12 @@ protected:
                         const bool isRestart,
                         const bool vapparsActive,
                         const bool enableHysteresis,
-                        unsigned numTracers);
+                        unsigned numTracers,
+                        const bool summaryOnly);
+
+    // Free the buffers of the cell based restart fields. They are only
+    // allocated again if they are requested for the current report step.
+    void releaseFieldBuffers_();
 
     void fipUnitConvert_(std::unordered_map<Inplace::Phase, Scalar>& fip) const;
 
@@ -259,10 +264,8 @@ protected:
 
     void outputFipLogImpl(const Inplace& inplace) const;
 
-    void makeRegionSum(Inplace& inplace,
-                       const std::string& region_name,
-                       const Comm& comm) const;
-
+    // Sum the fluid in place and pore volume quantities over the regions of
+    // all the region sets, in one pass over the cells and one reduction.
     Inplace accumulateRegionSums(const Comm& comm);
 
     void updateSummaryRegionValues(const Inplace& inplace,
@@ -282,15 +285,6 @@ protected:
                                          const ScalarBuffer& pressurePv,
                                          const ScalarBuffer& pv,
                                          bool hydrocarbon);
-    // Sum Fip values over regions.
-    static ScalarBuffer regionSum(const ScalarBuffer& property,
-                                  const std::vector<int>& regionId,
-                                  const std::size_t maxNumberOfRegions,
-                                  const Comm& comm);
-
-    static int regionMax(const std::vector<int>& region,
-                         const Comm& comm);
-
     static void update(Inplace& inplace,
                        const std::string& region_name,
                        const Inplace::Phase phase,
@@ -23,6 +23,7 @@
 
 #include <config.h>
 #include <ebos/eclgenericwriter.hh>
+#include <ebos/ecloutputqueue.hh>
 
 #include <opm/grid/CpGrid.hpp>
 #include <opm/grid/cpgrid/GridHelpers.hpp>
@@ -34,13 +35,17 @@
 #include <opm/output/eclipse/Summary.hpp>
 
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/parser/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Action/State.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQState.hpp>
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/simulators/utils/DistributedRestart.hpp>
+
 #include <dune/grid/common/mcmgmapper.hh>
+#include <dune/grid/common/rangegenerators.hh>
 
 #if HAVE_DUNE_FEM
 #include <dune/fem/gridpart/adaptiveleafgridpart.hh>
@@ -52,6 +57,10 @@
 #include <mpi.h>
 #endif
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
 namespace {
 
 /*!
@@ -114,6 +123,8 @@ struct EclWriteTasklet : public Opm::TaskletInterface
     double secondsElapsed_;
     Opm::RestartValue restartValue_;
     bool writeDoublePrecision_;
+    std::shared_ptr<Opm::EclOutputQueue> queue_;
+    std::size_t snapshotBytes_;
 
     explicit EclWriteTasklet(const Opm::Action::State& actionState,
                              const Opm::SummaryState& summaryState,
@@ -122,8 +133,10 @@ struct EclWriteTasklet : public Opm::TaskletInterface
                              int reportStepNum,
                              bool isSubStep,
                              double secondsElapsed,
-                             Opm::RestartValue restartValue,
-                             bool writeDoublePrecision)
+                             Opm::RestartValue&& restartValue,
+                             bool writeDoublePrecision,
+                             std::shared_ptr<Opm::EclOutputQueue> queue,
+                             std::size_t snapshotBytes)
         : actionState_(actionState)
         , summaryState_(summaryState)
         , udqState_(udqState)
@@ -131,24 +144,51 @@ struct EclWriteTasklet : public Opm::TaskletInterface
         , reportStepNum_(reportStepNum)
         , isSubStep_(isSubStep)
         , secondsElapsed_(secondsElapsed)
-        , restartValue_(restartValue)
+        , restartValue_(std::move(restartValue))
         , writeDoublePrecision_(writeDoublePrecision)
+        , queue_(std::move(queue))
+        , snapshotBytes_(snapshotBytes)
     { }
 
     // callback to eclIO serial writeTimeStep method
     void run()
     {
-        eclIO_.writeTimeStep(actionState_,
-                             summaryState_,
-                             udqState_,
-                             reportStepNum_,
-                             isSubStep_,
-                             secondsElapsed_,
-                             restartValue_,
-                             writeDoublePrecision_);
+        try {
+            eclIO_.writeTimeStep(actionState_,
+                                 summaryState_,
+                                 udqState_,
+                                 reportStepNum_,
+                                 isSubStep_,
+                                 secondsElapsed_,
+                                 restartValue_,
+                                 writeDoublePrecision_);
+        }
+        catch (...) {
+            queue_->release(snapshotBytes_);
+            throw;
+        }
+
+        // the runner may keep the tasklet alive for a while, so free the
+        // snapshot before its memory is given back to the queue
+        restartValue_.solution.clear();
+        restartValue_.extra.clear();
+        queue_->release(snapshotBytes_);
     }
 };
 
+// approximate memory footprint of the cell based part of a restart snapshot
+std::size_t snapshotSize(const Opm::RestartValue& restartValue)
+{
+    std::size_t numValues = 0;
+    for (const auto& [key, cellData] : restartValue.solution)
+        numValues += cellData.data.size();
+
+    for (const auto& [key, values] : restartValue.extra)
+        numValues += values.size();
+
+    return numValues * sizeof(double);
+}
+
 }
 
 namespace Opm {
@@ -163,7 +203,10 @@ EclGenericWriter(const Schedule& schedule,
                  const GridView& gridView,
                  const Dune::CartesianIndexMapper<Grid>& cartMapper,
                  const Dune::CartesianIndexMapper<EquilGrid>* equilCartMapper,
-                 bool enableAsyncOutput)
+                 bool enableAsyncOutput,
+                 int outputQueueSize,
+                 double outputMemoryBudget,
+                 bool enableDistributedRestart)
     : collectToIORank_(grid,
                        equilGrid,
                        gridView,
@@ -177,6 +220,7 @@ EclGenericWriter(const Schedule& schedule,
     , cartMapper_(cartMapper)
     , equilCartMapper_(equilCartMapper)
     , equilGrid_(equilGrid)
+    , enableDistributedRestart_(enableDistributedRestart)
 {
     if (collectToIORank_.isIORank()) {
         eclIO_.reset(new EclipseIO(eclState_,
@@ -201,6 +245,10 @@ EclGenericWriter(const Schedule& schedule,
     if (enableAsyncOutput && collectToIORank_.isIORank())
         numWorkerThreads = 1;
     taskletRunner_.reset(new TaskletRunner(numWorkerThreads));
+
+    // the memory budget is given in megabytes
+    const auto budgetBytes = static_cast<std::size_t>(std::max(outputMemoryBudget, 0.0) * 1024 * 1024);
+    outputQueue_ = std::make_shared<EclOutputQueue>(outputQueueSize, budgetBytes);
 }
 
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
@@ -401,17 +449,19 @@ doWriteOutput(const int                     reportStepNum,
 {
     const auto isParallel = this->collectToIORank_.isParallel();
 
+    // The gathered data is not needed after this point, the next call to
+    // collect() starts from scratch. Hence it can be moved into the snapshot.
     RestartValue restartValue {
-        isParallel ? this->collectToIORank_.globalCellData()
+        isParallel ? this->collectToIORank_.releaseGlobalCellData()
                    : std::move(localCellData),
 
-        isParallel ? this->collectToIORank_.globalWellData()
+        isParallel ? this->collectToIORank_.releaseGlobalWellData()
                    : std::move(localWellData),
 
-        isParallel ? this->collectToIORank_.globalGroupAndNetworkData()
+        isParallel ? this->collectToIORank_.releaseGlobalGroupAndNetworkData()
                    : std::move(localGroupAndNetworkData),
 
-        isParallel ? this->collectToIORank_.globalAquiferData()
+        isParallel ? this->collectToIORank_.releaseGlobalAquiferData()
                    : std::move(localAquiferData)
     };
 
@@ -425,21 +475,60 @@ doWriteOutput(const int                     reportStepNum,
         restartValue.addExtra("OPMEXTRA", std::vector<double>(1, nextStepSize));
     }
 
-    // first, create a tasklet to write the data for the current time
+    // first, wait until the output queue has room for the snapshot. This
+    // only blocks if the queue is full or its memory budget is exhausted.
+    // There is a single output thread, so the requests are still written
+    // in order.
+    const auto snapshotBytes = snapshotSize(restartValue);
+    this->outputQueue_->acquire(snapshotBytes);
+
+    // then, create a tasklet to write the data for the current time
     // step to disk
     auto eclWriteTasklet = std::make_shared<EclWriteTasklet>(
         actionState, summaryState, udqState, *this->eclIO_,
-        reportStepNum, isSubStep, curTime, std::move(restartValue), doublePrecision);
-
-    // then, make sure that the previous I/O request has been completed
-    // and the number of incomplete tasklets does not increase between
-    // time steps
-    this->taskletRunner_->barrier();
+        reportStepNum, isSubStep, curTime, std::move(restartValue), doublePrecision,
+        this->outputQueue_, snapshotBytes);
 
     // finally, start a new output writing job
     this->taskletRunner_->dispatch(std::move(eclWriteTasklet));
 }
 
+template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
+void EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
+writeDistributedCellData(int reportStepNum,
+                         const data::Solution& localCellData,
+                         bool doublePrecision)
+{
+    // same condition as the restart file written by EclipseIO
+    if (!schedule_.write_rst_file(reportStepNum))
+        return;
+
+    // the interior cells and their global index do not change during the run
+    if (distributedNumGlobalCells_ < 0) {
+        ElementMapper elemMapper(gridView_, Dune::mcmgElementLayout());
+        for (const auto& elem : elements(gridView_, Dune::Partitions::interior)) {
+            const int elemIdx = elemMapper.index(elem);
+            distributedLocalCells_.push_back(elemIdx);
+            distributedGlobalIndex_.push_back(collectToIORank_.localIdxToGlobalIdx(elemIdx));
+        }
+        distributedNumGlobalCells_ = grid_.comm().sum(static_cast<int>(distributedLocalCells_.size()));
+    }
+
+    const auto fileName = distributedRestartFileName(eclState_.getIOConfig().fullBasePath(),
+                                                     grid_.comm().rank());
+    writeDistributedRestartStep(fileName,
+                                distributedRestartStarted_,
+                                reportStepNum,
+                                distributedNumGlobalCells_,
+                                distributedLocalCells_,
+                                distributedGlobalIndex_,
+                                localCellData,
+                                eclState_.getUnits(),
+                                doublePrecision,
+                                eclState_.getIOConfig().getEclCompatibleRST());
+    distributedRestartStarted_ = true;
+}
+
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
 void EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
 evalSummary(int reportStepNum,
@@ -35,6 +35,7 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -44,6 +45,7 @@ namespace Opm {
 namespace Action { class State; }
 class EclipseIO;
 class EclipseState;
+class EclOutputQueue;
 class Inplace;
 struct NNCdata;
 class Schedule;
@@ -69,7 +71,10 @@ public:
                      const GridView& gridView,
                      const Dune::CartesianIndexMapper<Grid>& cartMapper,
                      const Dune::CartesianIndexMapper<EquilGrid>* equilCartMapper,
-                     bool enableAsyncOutput);
+                     bool enableAsyncOutput,
+                     int outputQueueSize,
+                     double outputMemoryBudget,
+                     bool enableDistributedRestart);
 
     const EclipseIO& eclIO() const;
 
@@ -97,6 +102,17 @@ protected:
                        Scalar nextStepSize,
                        bool doublePrecision);
 
+    // Whether every rank writes the restart arrays of its own cells instead
+    // of gathering them on the I/O rank, see DistributedRestart.hpp.
+    bool distributedRestartOutput() const
+    { return enableDistributedRestart_ && collectToIORank_.isParallel(); }
+
+    // Collective: write the restart arrays of the interior cells of this rank
+    // if a restart file is written at this report step.
+    void writeDistributedCellData(int reportStepNum,
+                                  const data::Solution& localCellData,
+                                  bool doublePrecision);
+
     void evalSummary(int reportStepNum,
                      Scalar curTime,
                      const std::map<std::size_t, double>& wbpData,
@@ -119,12 +135,18 @@ protected:
     const SummaryConfig& summaryConfig_;
     std::unique_ptr<EclipseIO> eclIO_;
     std::unique_ptr<TaskletRunner> taskletRunner_;
+    std::shared_ptr<EclOutputQueue> outputQueue_;
     Scalar restartTimeStepSize_;
     const TransmissibilityType* globalTrans_ = nullptr;
     const Dune::CartesianIndexMapper<Grid>& cartMapper_;
     const Dune::CartesianIndexMapper<EquilGrid>* equilCartMapper_;
     const EquilGrid* equilGrid_;
     std::vector<std::size_t> wbp_index_list_;
+    bool enableDistributedRestart_;
+    bool distributedRestartStarted_ = false;
+    std::vector<int> distributedLocalCells_;
+    std::vector<int> distributedGlobalIndex_;
+    int distributedNumGlobalCells_ = -1;
 
 private:
     data::Solution computeTrans_(const std::unordered_map<int,int>& cartesianToActive) const;
@@ -160,8 +160,12 @@ public:
     /*!
      * \brief Allocate memory for the scalar fields we would like to
      *        write to ECL output files
+     *
+     * If summaryOnly is true, the cell based restart fields are not
+     * allocated, even at the end of a report step.
      */
-    void allocBuffers(unsigned bufferSize, unsigned reportStepNum, const bool substep, const bool log, const bool isRestart)
+    void allocBuffers(unsigned bufferSize, unsigned reportStepNum, const bool substep, const bool log, const bool isRestart,
+                      const bool summaryOnly = false)
     {
         if (!std::is_same<Discretization, EcfvDiscretization<TypeTag> >::value)
             return;
@@ -173,7 +177,8 @@ public:
                              isRestart,
                              simulator_.problem().vapparsActive(std::max(simulator_.episodeIndex(), 0)),
                              simulator_.problem().materialLawManager()->enableHysteresis(),
-                             simulator_.problem().tracerModel().numTracers());
+                             simulator_.problem().tracerModel().numTracers(),
+                             summaryOnly);
     }
 
     /*!
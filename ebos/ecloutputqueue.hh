@@ -0,0 +1,88 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::EclOutputQueue
+ */
+#ifndef EWOMS_ECL_OUTPUT_QUEUE_HH
+#define EWOMS_ECL_OUTPUT_QUEUE_HH
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace Opm {
+
+/*!
+ * \brief Bookkeeping for the output requests which have been handed to the
+ *        output thread but not yet written.
+ *
+ * A new request is only admitted if there are less than maxSize requests
+ * pending and the snapshots of all pending requests fit into the memory
+ * budget. A request which alone exceeds the budget is admitted once the
+ * queue is empty, so output never stalls forever.
+ */
+class EclOutputQueue
+{
+public:
+    EclOutputQueue(int maxSize, std::size_t maxBytes)
+        : maxSize_(std::max(maxSize, 1))
+        , maxBytes_(maxBytes)
+    { }
+
+    // block the caller until a request of the given size can be queued
+    void acquire(std::size_t bytes)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        slotFreed_.wait(lock, [this, bytes]() {
+            return numPending_ == 0
+                || (numPending_ < maxSize_ && pendingBytes_ + bytes <= maxBytes_);
+        });
+        ++numPending_;
+        pendingBytes_ += bytes;
+    }
+
+    void release(std::size_t bytes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --numPending_;
+            pendingBytes_ -= bytes;
+        }
+        slotFreed_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable slotFreed_;
+    int maxSize_;
+    std::size_t maxBytes_;
+    int numPending_ = 0;
+    std::size_t pendingBytes_ = 0;
+};
+
+} // namespace Opm
+
+#endif // EWOMS_ECL_OUTPUT_QUEUE_HH
@@ -69,6 +69,7 @@
 #include <opm/core/props/satfunc/RelpermDiagnostics.hpp>
 
 #include <opm/models/utils/pffgridvector.hh>
+#include <opm/models/parallel/threadedentityiterator.hh>
 #include <opm/models/blackoil/blackoilmodel.hh>
 #include <opm/models/discretization/ecfv/ecfvdiscretization.hh>
 
@@ -438,6 +439,25 @@ struct EnableAsyncEclOutput<TypeTag, TTag::EclBaseProblem> {
     static constexpr bool value = true;
 };
 
+// Allow a few output requests to be pending while the simulation continues
+template<class TypeTag>
+struct EclOutputQueueSize<TypeTag, TTag::EclBaseProblem> {
+    static constexpr int value = 4;
+};
+
+// ... as long as their snapshots use less than 1 GB of memory
+template<class TypeTag>
+struct EclOutputMemoryBudget<TypeTag, TTag::EclBaseProblem> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 1024.0;
+};
+
+// Gather the restart cell data on the I/O rank by default
+template<class TypeTag>
+struct EnableDistributedRestartOutput<TypeTag, TTag::EclBaseProblem> {
+    static constexpr bool value = false;
+};
+
 // By default, use single precision for the ECL formated results
 template<class TypeTag>
 struct EclOutputDoublePrecision<TypeTag, TTag::EclBaseProblem> {
@@ -1051,22 +1071,18 @@ public:
                              this->simulator().timeStepSize(),
                              this->simulator().endTime());
 
-        // update maximum water saturation and minimum pressure
-        // used when ROCKCOMP is activated
-        const bool invalidateFromMaxWaterSat = updateMaxWaterSaturation_();
-        const bool invalidateFromMinPressure = updateMinPressure_();
-
-        // update hysteresis and max oil saturation used in vappars
-        const bool invalidateFromHyst = updateHysteresis_();
-        const bool invalidateFromMaxOilSat = updateMaxOilSaturation_();
+        // update maximum water saturation and minimum pressure used when ROCKCOMP is
+        // activated, hysteresis, max oil saturation used in vappars and, if possible,
+        // the max polymer adsorption
+        const bool invalidateIntensiveQuantities = updateElementHistory_();
 
         // the derivatives may have change
-        bool invalidateIntensiveQuantities = invalidateFromMaxWaterSat || invalidateFromMinPressure || invalidateFromHyst || invalidateFromMaxOilSat;
-        if (invalidateIntensiveQuantities)
+        if (invalidateIntensiveQuantities) {
             this->model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
 
-        if constexpr (getPropValue<TypeTag, Properties::EnablePolymer>())
-            updateMaxPolymerAdsorption_();
+            if constexpr (getPropValue<TypeTag, Properties::EnablePolymer>())
+                updateMaxPolymerAdsorption_();
+        }
 
         wellModel_.beginTimeStep();
         if (enableAquifers_)
@@ -1409,6 +1425,21 @@ public:
     Scalar thresholdPressure(unsigned elem1Idx, unsigned elem2Idx) const
     { return thresholdPressures_.thresholdPressure(elem1Idx, elem2Idx); }
 
+    /*!
+     * \brief Return the threshold pressure of a face of the stencil of an element.
+     *
+     * Unlike thresholdPressure(elem1Idx, elem2Idx), this reads the value from the
+     * prefetch friendly per-face storage.
+     */
+    template <class Context>
+    Scalar thresholdPressure(const Context& context,
+                             [[maybe_unused]] unsigned fromDofLocalIdx,
+                             unsigned toDofLocalIdx) const
+    {
+        assert(fromDofLocalIdx == 0);
+        return pffDofData_.get(context.element(), toDofLocalIdx).thresholdPressure;
+    }
+
     const EclThresholdPressure<TypeTag>& thresholdPressure() const
     { return thresholdPressures_; }
 
@@ -1808,6 +1839,10 @@ public:
         // the initial solution.
         thresholdPressures_.finishInit();
 
+        // the threshold pressures are part of the per-face data, so it needs to be
+        // refreshed now that they are known
+        updatePffDofData_();
+
         updateCompositionChangeLimits_();
 
         if (enableAquifers_)
@@ -2006,6 +2041,33 @@ public:
     }
 
 private:
+    // Call func(compressedDofIdx, intQuants) for all elements, including the ones in
+    // the ghost and overlap regions, with the intensive quantities of the current
+    // solution. The elements are distributed on the threads, so func must only
+    // modify data belonging to the element it is called for.
+    template <class Func>
+    void forAllElementIntensiveQuantities_(const Func& func) const
+    {
+        const auto& simulator = this->simulator();
+        ThreadedEntityIterator<GridView, /*codim=*/0> threadedElemIt(simulator.vanguard().gridView());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            ElementContext elemCtx(simulator);
+            auto elemIt = threadedElemIt.beginParallel();
+            for (; !threadedElemIt.isFinished(elemIt); elemIt = threadedElemIt.increment()) {
+                const Element& elem = *elemIt;
+
+                elemCtx.updatePrimaryStencil(elem);
+                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+
+                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
+                func(compressedDofIdx, elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0));
+            }
+        }
+    }
+
     // update the parameters needed for DRSDT and DRVDT
     void updateCompositionChangeLimits_()
     {
@@ -2014,25 +2076,24 @@ private:
         const auto& simulator = this->simulator();
         int episodeIdx = this->episodeIndex();
 
-        if (this->drsdtConvective_(episodeIdx)) {
-            // This implements the convective DRSDT as described in
-            // Sandve et al. "Convective dissolution in field scale CO2 storage simulations using the OPM Flow simulator"
-            // Submitted to TCCS 11, 2021
-            Scalar g = this->gravity_[dim - 1];
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
+        const bool drsdtConvective = this->drsdtConvective_(episodeIdx);
+        const bool drsdtActive = this->drsdtActive_(episodeIdx);
+        const bool drvdtActive = this->drvdtActive_(episodeIdx);
+        if (!drsdtConvective && !drsdtActive && !drvdtActive)
+            return;
+
+        const Scalar g = this->gravity_[dim - 1];
+        const auto& vanguard = simulator.vanguard();
+        forAllElementIntensiveQuantities_([&](unsigned compressedDofIdx, const auto& iq) {
+            const auto& fs = iq.fluidState();
+
+            if (drsdtConvective) {
+                // This implements the convective DRSDT as described in
+                // Sandve et al. "Convective dissolution in field scale CO2 storage simulations using the OPM Flow simulator"
+                // Submitted to TCCS 11, 2021
                 const DimMatrix& perm = intrinsicPermeability(compressedDofIdx);
                 const Scalar permz = perm[dim - 1][dim - 1]; // The Z permeability
                 Scalar distZ = vanguard.cellThickness(compressedDofIdx);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
                 Scalar t = getValue(fs.temperature(FluidSystem::oilPhaseIdx));
                 Scalar p = getValue(fs.pressure(FluidSystem::oilPhaseIdx));
                 Scalar so = getValue(fs.saturation(FluidSystem::oilPhaseIdx));
@@ -2049,27 +2110,12 @@ private:
                 // i.e. we only allow for fingers moving downward
                 this->convectiveDrs_[compressedDofIdx] = permz * rssat * max(0.0, deltaDensity) * g / ( so * visc * distZ * poro);
             }
-        }
 
-        if (this->drsdtActive_(episodeIdx)) {
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
-
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
-
-                using FluidState = typename std::decay<decltype(fs)>::type;
+            using FluidState = typename std::decay<decltype(fs)>::type;
 
+            if (drsdtActive) {
                 int pvtRegionIdx = this->pvtRegionIndex(compressedDofIdx);
-                const auto& oilVaporizationControl = simulator.vanguard().schedule()[episodeIdx].oilvap();
+                const auto& oilVaporizationControl = vanguard.schedule()[episodeIdx].oilvap();
                 if (oilVaporizationControl.getOption(pvtRegionIdx) || fs.saturation(gasPhaseIdx) > freeGasMinSaturation_)
                     this->lastRs_[compressedDofIdx] =
                         BlackOil::template getRs_<FluidSystem,
@@ -2078,123 +2124,80 @@ private:
                 else
                     this->lastRs_[compressedDofIdx] = std::numeric_limits<Scalar>::infinity();
             }
-        }
-
-        // update the "last Rv" values for all elements, including the ones in the ghost
-        // and overlap regions
-        if (this->drvdtActive_(episodeIdx)) {
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
-
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
-
-                using FluidState = typename std::decay<decltype(fs)>::type;
 
+            // update the "last Rv" values for all elements, including the ones in the ghost
+            // and overlap regions
+            if (drvdtActive) {
                 this->lastRv_[compressedDofIdx] =
                     BlackOil::template getRv_<FluidSystem,
                                               FluidState,
                                               Scalar>(fs, iq.pvtRegionIndex());
             }
-        }
+        });
     }
 
-    bool updateMaxOilSaturation_()
+    // Update the per element history used by ROCKCOMP (maximum water saturation and
+    // minimum pressure), by hysteresis and by VAPPARS (maximum oil saturation) in one
+    // pass over the elements. Returns true if the intensive quantities need to be
+    // updated afterwards, otherwise the maximum polymer adsorption is updated in the
+    // same pass.
+    bool updateElementHistory_()
     {
-        const auto& simulator = this->simulator();
-        int episodeIdx = this->episodeIndex();
-
+        // water compaction is activated in ROCKCOMP
+        const bool updateMaxWaterSat = !this->maxWaterSaturation_.empty();
+        // IRREVERS option is used in ROCKCOMP
+        const bool updateMinPressure = !this->minOilPressure_.empty();
+        // we need to update the hysteresis data for _all_ elements (i.e., not just the
+        // interior ones) to avoid desynchronization of the processes in the parallel case!
+        const bool updateHyst = materialLawManager_->enableHysteresis();
         // we use VAPPARS
-        if (this->vapparsActive(episodeIdx)) {
-            ElementContext elemCtx(simulator);
-            const auto& vanguard = simulator.vanguard();
-            auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-            const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-            for (; elemIt != elemEndIt; ++elemIt) {
-                const Element& elem = *elemIt;
+        const bool updateMaxOilSat = this->vapparsActive(this->episodeIndex());
 
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+        // we need to invalidate the intensive quantities cache afterwards because
+        // e.g. the derivatives of Rs and Rv will most likely have changed
+        const bool invalidate = updateMaxWaterSat || updateMinPressure || updateHyst || updateMaxOilSat;
 
-                unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = iq.fluidState();
-
-                Scalar So = decay<Scalar>(fs.saturation(oilPhaseIdx));
+        // the max polymer adsorption must be computed with the updated intensive
+        // quantities, hence it is only done here if they are not invalidated
+        constexpr bool enablePolymer = getPropValue<TypeTag, Properties::EnablePolymer>();
+        const bool updatePolymer = enablePolymer && !invalidate;
 
-                this->maxOilSaturation_[compressedDofIdx] = std::max(this->maxOilSaturation_[compressedDofIdx], So);
-            }
-
-            // we need to invalidate the intensive quantities cache here because the
-            // derivatives of Rs and Rv will most likely have changed
-            return true;
-        }
-
-        return false;
-    }
-
-    bool updateMaxWaterSaturation_()
-    {
-        // water compaction is activated in ROCKCOMP
-        if (this->maxWaterSaturation_.empty())
+        if (!invalidate && !updatePolymer)
             return false;
 
-        this->maxWaterSaturation_[/*timeIdx=*/1] = this->maxWaterSaturation_[/*timeIdx=*/0];
-        ElementContext elemCtx(this->simulator());
-        const auto& vanguard = this->simulator().vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
+        if (updateMaxWaterSat)
+            this->maxWaterSaturation_[/*timeIdx=*/1] = this->maxWaterSaturation_[/*timeIdx=*/0];
 
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
+        forAllElementIntensiveQuantities_([&](unsigned compressedDofIdx, const auto& iq) {
             const auto& fs = iq.fluidState();
 
-            Scalar Sw = decay<Scalar>(fs.saturation(waterPhaseIdx));
-            this->maxWaterSaturation_[compressedDofIdx] = std::max(this->maxWaterSaturation_[compressedDofIdx], Sw);
-        }
-
-        return true;
-    }
-
-    bool updateMinPressure_()
-    {
-        // IRREVERS option is used in ROCKCOMP
-        if (this->minOilPressure_.empty())
-            return false;
+            if (updateMaxWaterSat) {
+                Scalar Sw = decay<Scalar>(fs.saturation(waterPhaseIdx));
+                this->maxWaterSaturation_[compressedDofIdx] = std::max(this->maxWaterSaturation_[compressedDofIdx], Sw);
+            }
 
-        ElementContext elemCtx(this->simulator());
-        const auto& vanguard = this->simulator().vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
+            if (updateMinPressure) {
+                this->minOilPressure_[compressedDofIdx] =
+                    std::min(this->minOilPressure_[compressedDofIdx],
+                             getValue(fs.pressure(oilPhaseIdx)));
+            }
 
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+            if (updateHyst)
+                materialLawManager_->updateHysteresis(fs, compressedDofIdx);
 
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& iq = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& fs = iq.fluidState();
+            if (updateMaxOilSat) {
+                Scalar So = decay<Scalar>(fs.saturation(oilPhaseIdx));
+                this->maxOilSaturation_[compressedDofIdx] = std::max(this->maxOilSaturation_[compressedDofIdx], So);
+            }
 
-            this->minOilPressure_[compressedDofIdx] =
-                std::min(this->minOilPressure_[compressedDofIdx],
-                         getValue(fs.pressure(oilPhaseIdx)));
-        }
+            if constexpr (enablePolymer) {
+                if (updatePolymer)
+                    this->maxPolymerAdsorption_[compressedDofIdx] = std::max(this->maxPolymerAdsorption_[compressedDofIdx],
+                                                                             scalarValue(iq.polymerAdsorption()));
+            }
+        });
 
-        return true;
+        return invalidate;
     }
 
     void readMaterialParameters_()
@@ -2607,52 +2610,13 @@ private:
         }
     }
 
-    // update the hysteresis parameters of the material laws for the whole grid
-    bool updateHysteresis_()
-    {
-        if (!materialLawManager_->enableHysteresis())
-            return false;
-
-        // we need to update the hysteresis data for _all_ elements (i.e., not just the
-        // interior ones) to avoid desynchronization of the processes in the parallel case!
-        const auto& simulator = this->simulator();
-        ElementContext elemCtx(simulator);
-        const auto& vanguard = simulator.vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
-
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-            materialLawManager_->updateHysteresis(intQuants.fluidState(), compressedDofIdx);
-        }
-        return true;
-    }
-
     void updateMaxPolymerAdsorption_()
     {
         // we need to update the max polymer adsoption data for all elements
-        const auto& simulator = this->simulator();
-        ElementContext elemCtx(simulator);
-        const auto& vanguard = simulator.vanguard();
-        auto elemIt = vanguard.gridView().template begin</*codim=*/0>();
-        const auto& elemEndIt = vanguard.gridView().template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const Element& elem = *elemIt;
-
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-            unsigned compressedDofIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-
+        forAllElementIntensiveQuantities_([this](unsigned compressedDofIdx, const auto& intQuants) {
             this->maxPolymerAdsorption_[compressedDofIdx] = std::max(this->maxPolymerAdsorption_[compressedDofIdx],
                                                                      scalarValue(intQuants.polymerAdsorption()));
-        }
+        });
     }
 
     struct PffDofData_
@@ -2661,6 +2625,7 @@ private:
         ConditionalStorage<enableEnergy, Scalar> thermalHalfTransOut;
         ConditionalStorage<enableDiffusion, Scalar> diffusivity;
         Scalar transmissibility;
+        Scalar thresholdPressure;
     };
 
     // update the prefetch friendly data object
@@ -2677,14 +2642,16 @@ private:
             unsigned globalElemIdx = elementMapper.index(stencil.entity(localDofIdx));
             if (localDofIdx != 0) {
                 unsigned globalCenterElemIdx = elementMapper.index(stencil.entity(/*dofIdx=*/0));
-                dofData.transmissibility = transmissibilities_.transmissibility(globalCenterElemIdx, globalElemIdx);
+                unsigned faceIdx = transmissibilities_.faceIndex(globalCenterElemIdx, globalElemIdx);
+                dofData.transmissibility = transmissibilities_.transmissibilityFace(faceIdx);
+                dofData.thresholdPressure = thresholdPressures_.thresholdPressure(globalCenterElemIdx, globalElemIdx);
 
                 if constexpr (enableEnergy) {
-                    *dofData.thermalHalfTransIn = transmissibilities_.thermalHalfTrans(globalCenterElemIdx, globalElemIdx);
-                    *dofData.thermalHalfTransOut = transmissibilities_.thermalHalfTrans(globalElemIdx, globalCenterElemIdx);
+                    *dofData.thermalHalfTransIn = transmissibilities_.thermalHalfTransInFace(faceIdx);
+                    *dofData.thermalHalfTransOut = transmissibilities_.thermalHalfTransOutFace(faceIdx);
                 }
                 if constexpr (enableDiffusion)
-                    *dofData.diffusivity = transmissibilities_.diffusivity(globalCenterElemIdx, globalElemIdx);
+                    *dofData.diffusivity = transmissibilities_.diffusivityFace(faceIdx);
             }
         };
 
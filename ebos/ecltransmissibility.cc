@@ -47,8 +47,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 
 namespace {
 
@@ -107,39 +109,66 @@ template<class Grid, class GridView, class ElementMapper, class Scalar>
 Scalar EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 transmissibility(unsigned elemIdx1, unsigned elemIdx2) const
 {
-    return trans_.at(isId(elemIdx1, elemIdx2));
+    return faceTrans_[faceIndex(elemIdx1, elemIdx2)];
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 Scalar EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 transmissibilityBoundary(unsigned elemIdx, unsigned boundaryFaceIdx) const
 {
-    return transBoundary_.at(std::make_pair(elemIdx, boundaryFaceIdx));
+    if (elemIdx + 1 >= boundaryOffsets_.size() ||
+        boundaryOffsets_[elemIdx] + boundaryFaceIdx >= boundaryOffsets_[elemIdx + 1])
+        throw std::out_of_range("No boundary transmissibility for the given intersection");
+
+    return boundaryTrans_[boundaryOffsets_[elemIdx] + boundaryFaceIdx];
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 Scalar EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 thermalHalfTrans(unsigned insideElemIdx, unsigned outsideElemIdx) const
 {
-    return thermalHalfTrans_.at(directionalIsId(insideElemIdx, outsideElemIdx));
+    return faceThermalHalfTransIn_.at(faceIndex(insideElemIdx, outsideElemIdx));
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 Scalar EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 thermalHalfTransBoundary(unsigned insideElemIdx, unsigned boundaryFaceIdx) const
 {
-    return thermalHalfTransBoundary_.at(std::make_pair(insideElemIdx, boundaryFaceIdx));
+    if (insideElemIdx + 1 >= boundaryOffsets_.size() ||
+        boundaryOffsets_[insideElemIdx] + boundaryFaceIdx >= boundaryOffsets_[insideElemIdx + 1])
+        throw std::out_of_range("No thermal boundary half transmissibility for the given intersection");
+
+    return boundaryThermalHalfTrans_.at(boundaryOffsets_[insideElemIdx] + boundaryFaceIdx);
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 Scalar EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
 diffusivity(unsigned elemIdx1, unsigned elemIdx2) const
 {
-    if (diffusivity_.empty())
+    if (faceDiffusivity_.empty())
         return 0.0;
 
-    return diffusivity_.at(isId(elemIdx1, elemIdx2));
+    return faceDiffusivity_[faceIndex(elemIdx1, elemIdx2)];
+
+}
 
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+unsigned EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+faceIndex(unsigned elemIdx1, unsigned elemIdx2) const
+{
+    if (elemIdx1 + 1 >= faceOffsets_.size())
+        throw std::out_of_range("Element index out of range for face lookup");
+
+    // the rows are short (6 faces for a regular corner-point cell plus the NNCs), so
+    // the binary search only touches one or two cache lines.
+    const auto begin = faceNeighbors_.begin() + faceOffsets_[elemIdx1];
+    const auto end = faceNeighbors_.begin() + faceOffsets_[elemIdx1 + 1];
+    const auto it = std::lower_bound(begin, end, elemIdx2);
+    if (it == end || *it != elemIdx2)
+        throw std::out_of_range("Elements " + std::to_string(elemIdx1) + " and "
+                                + std::to_string(elemIdx2) + " do not share a face");
+
+    return static_cast<unsigned>(it - faceNeighbors_.begin());
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
@@ -489,6 +518,127 @@ update(bool global)
 
     //remove very small non-neighbouring transmissibilities
     removeSmallNonCartesianTransmissibilities_();
+
+    buildFaceStorage_(elemMapper, numElements);
+}
+
+template<class Grid, class GridView, class ElementMapper, class Scalar>
+void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
+buildFaceStorage_(const ElementMapper& elemMapper, unsigned numElements)
+{
+    // count the neighbors and the boundary intersections of each element. The
+    // boundary intersection index used by transBoundary_ also counts the
+    // intersections on process boundaries, so these get a (zero) slot as well.
+    faceOffsets_.assign(numElements + 1, 0);
+    boundaryOffsets_.assign(numElements + 1, 0);
+
+    auto elemIt = gridView_.template begin</*codim=*/ 0>();
+    const auto& elemEndIt = gridView_.template end</*codim=*/ 0>();
+    for (; elemIt != elemEndIt; ++elemIt) {
+        const auto& elem = *elemIt;
+        unsigned elemIdx = elemMapper.index(elem);
+
+        auto isIt = gridView_.ibegin(elem);
+        const auto& isEndIt = gridView_.iend(elem);
+        for (; isIt != isEndIt; ++ isIt) {
+            const auto& intersection = *isIt;
+            if (intersection.boundary() || !intersection.neighbor())
+                ++boundaryOffsets_[elemIdx + 1];
+            else
+                ++faceOffsets_[elemIdx + 1];
+        }
+    }
+
+    std::partial_sum(faceOffsets_.begin(), faceOffsets_.end(), faceOffsets_.begin());
+    std::partial_sum(boundaryOffsets_.begin(), boundaryOffsets_.end(), boundaryOffsets_.begin());
+
+    // collect the neighbors of each element
+    faceNeighbors_.resize(faceOffsets_.back());
+    std::vector<unsigned> rowPos(faceOffsets_.begin(), faceOffsets_.end() - 1);
+    elemIt = gridView_.template begin</*codim=*/ 0>();
+    for (; elemIt != elemEndIt; ++elemIt) {
+        const auto& elem = *elemIt;
+        unsigned elemIdx = elemMapper.index(elem);
+
+        auto isIt = gridView_.ibegin(elem);
+        const auto& isEndIt = gridView_.iend(elem);
+        for (; isIt != isEndIt; ++ isIt) {
+            const auto& intersection = *isIt;
+            if (intersection.boundary() || !intersection.neighbor())
+                continue;
+
+            faceNeighbors_[rowPos[elemIdx]++] = elemMapper.index(intersection.outside());
+        }
+    }
+
+    // sort the rows and remove duplicate neighbors. Two elements can be connected by
+    // more than one intersection, but they only have a single transmissibility.
+    unsigned numFaces = 0;
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+        const unsigned rowBegin = faceOffsets_[elemIdx];
+        const unsigned rowEnd = faceOffsets_[elemIdx + 1];
+        std::sort(faceNeighbors_.begin() + rowBegin, faceNeighbors_.begin() + rowEnd);
+
+        faceOffsets_[elemIdx] = numFaces;
+        for (unsigned pos = rowBegin; pos < rowEnd; ++pos) {
+            if (pos > rowBegin && faceNeighbors_[pos] == faceNeighbors_[numFaces - 1])
+                continue;
+            faceNeighbors_[numFaces++] = faceNeighbors_[pos];
+        }
+    }
+    faceOffsets_[numElements] = numFaces;
+    faceNeighbors_.resize(numFaces);
+    faceNeighbors_.shrink_to_fit();
+
+    auto lookup = [](const auto& map, std::uint64_t id) -> Scalar
+    {
+        auto candidate = map.find(id);
+        return candidate == map.end() ? 0.0 : candidate->second;
+    };
+
+    faceTrans_.resize(numFaces);
+    faceThermalHalfTransIn_.clear();
+    faceThermalHalfTransOut_.clear();
+    faceDiffusivity_.clear();
+    if (enableEnergy_) {
+        faceThermalHalfTransIn_.resize(numFaces);
+        faceThermalHalfTransOut_.resize(numFaces);
+    }
+    if (!diffusivity_.empty())
+        faceDiffusivity_.resize(numFaces);
+
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx) {
+        for (unsigned faceIdx = faceOffsets_[elemIdx]; faceIdx < faceOffsets_[elemIdx + 1]; ++faceIdx) {
+            unsigned neighborIdx = faceNeighbors_[faceIdx];
+            faceTrans_[faceIdx] = lookup(trans_, isId(elemIdx, neighborIdx));
+
+            if (enableEnergy_) {
+                faceThermalHalfTransIn_[faceIdx] = lookup(thermalHalfTrans_, directionalIsId(elemIdx, neighborIdx));
+                faceThermalHalfTransOut_[faceIdx] = lookup(thermalHalfTrans_, directionalIsId(neighborIdx, elemIdx));
+            }
+
+            if (!faceDiffusivity_.empty())
+                faceDiffusivity_[faceIdx] = lookup(diffusivity_, isId(elemIdx, neighborIdx));
+        }
+    }
+
+    boundaryTrans_.assign(boundaryOffsets_.back(), 0.0);
+    for (const auto& [key, value] : transBoundary_)
+        boundaryTrans_[boundaryOffsets_[key.first] + key.second] = value;
+
+    boundaryThermalHalfTrans_.clear();
+    if (enableEnergy_) {
+        boundaryThermalHalfTrans_.assign(boundaryOffsets_.back(), 0.0);
+        for (const auto& [key, value] : thermalHalfTransBoundary_)
+            boundaryThermalHalfTrans_[boundaryOffsets_[key.first] + key.second] = value;
+    }
+
+    // the hash maps are only needed while the transmissibilities are computed
+    std::unordered_map<std::uint64_t, Scalar>().swap(trans_);
+    std::unordered_map<std::uint64_t, Scalar>().swap(thermalHalfTrans_);
+    std::unordered_map<std::uint64_t, Scalar>().swap(diffusivity_);
+    transBoundary_.clear();
+    thermalHalfTransBoundary_.clear();
 }
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
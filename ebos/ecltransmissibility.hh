@@ -101,6 +101,64 @@ public:
      */
     Scalar diffusivity(unsigned elemIdx1, unsigned elemIdx2) const;
 
+    /*!
+     * \brief Return the index of the face between two neighboring elements.
+     *
+     * After update() all face quantities are stored in a compressed-row layout which
+     * follows the neighborhood of the grid: the faces of element \c elemIdx occupy the
+     * contiguous range [faceBegin(elemIdx), faceEnd(elemIdx)) and are sorted by the
+     * index of the neighboring element. Each face is thus stored twice, once for
+     * each of the two elements that share it. An exception of type std::out_of_range
+     * is thrown if the two elements are not neighbors.
+     */
+    unsigned faceIndex(unsigned elemIdx1, unsigned elemIdx2) const;
+
+    /*!
+     * \brief Return the first face index of an element in the face-ordered storage.
+     */
+    unsigned faceBegin(unsigned elemIdx) const
+    { return faceOffsets_[elemIdx]; }
+
+    /*!
+     * \brief Return the face index past the last face of an element in the
+     *        face-ordered storage.
+     */
+    unsigned faceEnd(unsigned elemIdx) const
+    { return faceOffsets_[elemIdx + 1]; }
+
+    /*!
+     * \brief Return the index of the neighboring element of a face.
+     */
+    unsigned faceNeighbor(unsigned faceIdx) const
+    { return faceNeighbors_[faceIdx]; }
+
+    /*!
+     * \brief Return the transmissibility of a face given its index in the
+     *        face-ordered storage.
+     */
+    Scalar transmissibilityFace(unsigned faceIdx) const
+    { return faceTrans_[faceIdx]; }
+
+    /*!
+     * \brief Return the thermal half transmissibility of the element a face belongs to.
+     */
+    Scalar thermalHalfTransInFace(unsigned faceIdx) const
+    { return faceThermalHalfTransIn_[faceIdx]; }
+
+    /*!
+     * \brief Return the thermal half transmissibility of the neighboring element of a
+     *        face.
+     */
+    Scalar thermalHalfTransOutFace(unsigned faceIdx) const
+    { return faceThermalHalfTransOut_[faceIdx]; }
+
+    /*!
+     * \brief Return the diffusivity of a face given its index in the face-ordered
+     *        storage.
+     */
+    Scalar diffusivityFace(unsigned faceIdx) const
+    { return faceDiffusivity_.empty() ? 0.0 : faceDiffusivity_[faceIdx]; }
+
     /*!
      * \brief Actually compute the transmissibility over a face as a pre-compute step.
      *
@@ -131,6 +189,13 @@ protected:
 
     void removeSmallNonCartesianTransmissibilities_();
 
+    /// \brief Moves the face quantities from the hash maps used during the
+    ///        computation into the face-ordered arrays.
+    ///
+    /// The hash maps are released afterwards, all subsequent lookups go
+    /// through the compressed-row storage.
+    void buildFaceStorage_(const ElementMapper& elemMapper, unsigned numElements);
+
     /// \brief Apply the Multipliers for the case PINCH(4)==TOPBOT
     ///
     /// \param pinchTop Whether PINCH(5) is TOP, otherwise ALL is assumed.
@@ -244,6 +309,20 @@ protected:
     bool enableDiffusivity_;
     std::unordered_map<std::uint64_t, Scalar> thermalHalfTrans_;
     std::unordered_map<std::uint64_t, Scalar> diffusivity_;
+
+    // face-ordered storage, see faceIndex()
+    std::vector<unsigned> faceOffsets_;
+    std::vector<unsigned> faceNeighbors_;
+    std::vector<Scalar> faceTrans_;
+    std::vector<Scalar> faceThermalHalfTransIn_;
+    std::vector<Scalar> faceThermalHalfTransOut_;
+    std::vector<Scalar> faceDiffusivity_;
+
+    // the boundary intersections of an element are stored contiguously in the
+    // order of their boundary intersection index
+    std::vector<unsigned> boundaryOffsets_;
+    std::vector<Scalar> boundaryTrans_;
+    std::vector<Scalar> boundaryThermalHalfTrans_;
 };
 
 } // namespace Opm
@@ -53,6 +53,18 @@ template<class TypeTag, class MyTypeTag>
 struct EclOutputDoublePrecision {
     using type = UndefinedProperty;
 };
+template<class TypeTag, class MyTypeTag>
+struct EclOutputQueueSize {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct EclOutputMemoryBudget {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct EnableDistributedRestartOutput {
+    using type = UndefinedProperty;
+};
 
 } // namespace Opm::Properties
 
@@ -108,6 +120,13 @@ public:
 
         EWOMS_REGISTER_PARAM(TypeTag, bool, EnableAsyncEclOutput,
                              "Write the ECL-formated results in a non-blocking way (i.e., using a separate thread).");
+        EWOMS_REGISTER_PARAM(TypeTag, int, EclOutputQueueSize,
+                             "Maximum number of ECL output requests which may be pending when writing asynchronously.");
+        EWOMS_REGISTER_PARAM(TypeTag, Scalar, EclOutputMemoryBudget,
+                             "Maximum size in megabytes of the pending ECL output requests when writing asynchronously.");
+        EWOMS_REGISTER_PARAM(TypeTag, bool, EnableDistributedRestartOutput,
+                             "Let every process write the restart cell data of its own part of the grid in parallel runs. "
+                             "The files are merged with the mergedrst program.");
     }
 
     // The Simulator object should preferably have been const - the
@@ -122,7 +141,10 @@ public:
                    simulator.vanguard().gridView(),
                    simulator.vanguard().cartesianIndexMapper(),
                    simulator.vanguard().grid().comm().rank() == 0 ? &simulator.vanguard().equilCartesianIndexMapper() : nullptr,
-                   EWOMS_GET_PARAM(TypeTag, bool, EnableAsyncEclOutput))
+                   EWOMS_GET_PARAM(TypeTag, bool, EnableAsyncEclOutput),
+                   EWOMS_GET_PARAM(TypeTag, int, EclOutputQueueSize),
+                   EWOMS_GET_PARAM(TypeTag, Scalar, EclOutputMemoryBudget),
+                   EWOMS_GET_PARAM(TypeTag, bool, EnableDistributedRestartOutput))
         , simulator_(simulator)
     {
         this->eclOutputModule_ = std::make_unique<EclOutputBlackOilModule<TypeTag>>(simulator, this->wbp_index_list_, this->collectToIORank_);
@@ -176,7 +198,8 @@ public:
 
         const auto localAquiferData = simulator_.problem().aquiferModel().aquiferData();
 
-        this->prepareLocalCellData(isSubStep, reportStepNum);
+        // the restart fields are evaluated in writeOutput()
+        this->prepareLocalCellData(isSubStep, reportStepNum, /*summaryOnly=*/true);
 
         if (this->collectToIORank_.isParallel())
             this->collectToIORank_.collect({},
@@ -223,7 +246,7 @@ public:
     {
         const int reportStepNum = simulator_.episodeIndex() + 1;
 
-        this->prepareLocalCellData(isSubStep, reportStepNum);
+        this->prepareLocalCellData(isSubStep, reportStepNum, /*summaryOnly=*/false);
         this->eclOutputModule_->outputErrorLog(simulator_.gridView().comm());
 
         // output using eclWriter if enabled
@@ -239,12 +262,22 @@ public:
 
             // add cell data to perforations for Rft output
             this->eclOutputModule_->addRftDataToWells(localWellData, reportStepNum);
+
+            // every process writes its own cells, only the well, group and
+            // aquifer data is collected on the I/O rank
+            if (this->distributedRestartOutput()) {
+                this->writeDistributedCellData(reportStepNum, localCellData,
+                                               EWOMS_GET_PARAM(TypeTag, bool, EclOutputDoublePrecision));
+                localCellData = {};
+            }
         }
 
+        // The block and WBP values are only used for the summary, which has
+        // already been evaluated in evalSummaryState(), so do not send them.
         if (this->collectToIORank_.isParallel()) {
             this->collectToIORank_.collect(localCellData,
-                                           eclOutputModule_->getBlockData(),
-                                           eclOutputModule_->getWBPData(),
+                                           {},
+                                           {},
                                            localWellData,
                                            localGroupAndNetworkData,
                                            localAquiferData);
@@ -359,14 +392,15 @@ private:
     { return simulator_.vanguard().schedule(); }
 
     void prepareLocalCellData(const bool isSubStep,
-                              const int  reportStepNum)
+                              const int  reportStepNum,
+                              const bool summaryOnly)
     {
         const auto& gridView = simulator_.vanguard().gridView();
         const int numElements = gridView.size(/*codim=*/0);
-        const bool log = this->collectToIORank_.isIORank();
+        const bool log = this->collectToIORank_.isIORank() && !summaryOnly;
 
         eclOutputModule_->allocBuffers(numElements, reportStepNum,
-                                      isSubStep, log, /*isRestart*/ false);
+                                      isSubStep, log, /*isRestart*/ false, summaryOnly);
 
         ElementContext elemCtx(simulator_);
         ElementIterator elemIt = gridView.template begin</*codim=*/0>();
@@ -0,0 +1,51 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/DistributedRestart.hpp>
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Merge the restart files written by the processes of a parallel run with
+// --enable-distributed-restart-output=true into the restart file(s) of the
+// run, <base>.UNRST or <base>.Xnnnn.
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " <output dir>/<CASE> [number of processes]\n";
+        return EXIT_FAILURE;
+    }
+
+    try {
+        const std::string basePath = argv[1];
+        const int numRanks = argc == 3 ? std::stoi(argv[2]) : 0;
+        const int numSteps = Opm::mergeDistributedRestart(basePath, numRanks);
+        std::cout << "Merged " << numSteps << " report steps into the restart file(s) of " << basePath << '\n';
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
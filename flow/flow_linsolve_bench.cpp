@@ -0,0 +1,202 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+// Replays linear systems written by flow with
+// --linear-system-dump-format=binary (and --linear-solver-verbosity > 10)
+// and times every given FlexibleSolver configuration on each of them.
+//
+// Usage: flow_linsolve_bench system.bin [system.bin ...] config.json [config.json ...]
+
+#include <opm/simulators/linalg/BinaryLinearSystem.hpp>
+#include <opm/simulators/linalg/FlexibleSolver.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
+
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/common/timer.hh>
+#include <dune/istl/operators.hh>
+
+#include <fmt/format.h>
+
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+
+// Resident set size in MB, or 0 if unavailable.
+double residentMemoryMB()
+{
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0;
+    long resident = 0;
+    if (!(statm >> pages >> resident)) {
+        return 0.0;
+    }
+    return resident * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+}
+
+bool endsWith(const std::string& s, const std::string& suffix)
+{
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// The reservoir matrix with the well contributions added, i.e. the
+// system that flow solves.
+template <class Matrix>
+Matrix addWells(const Matrix& matrix, const Matrix& wells)
+{
+    Matrix sum(matrix.N(), matrix.M(), Matrix::random);
+    std::vector<std::set<std::size_t>> pattern(matrix.N());
+    for (const auto* m : {&matrix, &wells}) {
+        for (auto row = m->begin(); row != m->end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                pattern[row.index()].insert(col.index());
+            }
+        }
+    }
+    for (std::size_t row = 0; row < pattern.size(); ++row) {
+        sum.setrowsize(row, pattern[row].size());
+    }
+    sum.endrowsizes();
+    for (std::size_t row = 0; row < pattern.size(); ++row) {
+        for (const auto col : pattern[row]) {
+            sum.addindex(row, col);
+        }
+    }
+    sum.endindices();
+    sum = 0.0;
+    for (const auto* m : {&matrix, &wells}) {
+        for (auto row = m->begin(); row != m->end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                sum[row.index()][col.index()] += *col;
+            }
+        }
+    }
+    return sum;
+}
+
+template <int bs>
+void benchmark(const std::string& systemFile,
+               const std::vector<std::string>& configFiles,
+               const std::size_t pressureIndex)
+{
+    using System = Opm::BinaryLinearSystem<bs>;
+    using Matrix = typename System::Matrix;
+    using Vector = typename System::Vector;
+
+    Dune::Timer timer;
+    System system = Opm::readBinaryLinearSystem<bs>(systemFile);
+    const Matrix matrix = system.hasWells ? addWells(system.matrix, system.wells) : system.matrix;
+    std::cout << fmt::format("{}: {} rows, block size {}, {} block nonzeros{} (read in {:.2f} s)\n",
+                             systemFile, matrix.N(), bs, matrix.nonzeroes(),
+                             system.hasWells ? ", with wells" : "", timer.elapsed());
+
+    auto weightsCalculator = [&system, &matrix, pressureIndex]() {
+        if (system.weights.size() == matrix.N()) {
+            return system.weights;
+        }
+        return Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, pressureIndex, false);
+    };
+
+    std::cout << fmt::format("  {:<32} {:>10} {:>10} {:>10} {:>6} {:>5} {:>10}\n",
+                             "configuration", "setup (s)", "update (s)", "solve (s)", "its", "conv", "mem (MB)");
+    for (const auto& configFile : configFiles) {
+        const Opm::PropertyTree prm(configFile);
+        Dune::MatrixAdapter<Matrix, Vector, Vector> op(matrix);
+
+        const double memBefore = residentMemoryMB();
+        timer.reset();
+        Dune::FlexibleSolver<Matrix, Vector> solver(op, prm, weightsCalculator, pressureIndex);
+        const double setupTime = timer.elapsed();
+        const double memory = residentMemoryMB() - memBefore;
+
+        timer.reset();
+        solver.preconditioner().update();
+        const double updateTime = timer.elapsed();
+
+        Vector x(matrix.M());
+        x = 0.0;
+        Vector rhs(system.rhs);
+        Dune::InverseOperatorResult res;
+        timer.reset();
+        solver.apply(x, rhs, res);
+        const double solveTime = timer.elapsed();
+
+        std::cout << fmt::format("  {:<32} {:10.4f} {:10.4f} {:10.4f} {:6} {:>5} {:10.1f}\n",
+                                 configFile, setupTime, updateTime, solveTime,
+                                 res.iterations, res.converged ? "yes" : "no", memory);
+    }
+}
+
+} // anonymous namespace
+
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+
+    std::vector<std::string> systemFiles;
+    std::vector<std::string> configFiles;
+    std::size_t pressureIndex = 1;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        if (arg.rfind("--pressure-index=", 0) == 0) {
+            pressureIndex = std::stoul(arg.substr(17));
+        } else if (endsWith(arg, ".json")) {
+            configFiles.push_back(arg);
+        } else {
+            systemFiles.push_back(arg);
+        }
+    }
+    if (systemFiles.empty() || configFiles.empty()) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--pressure-index=1] system.bin [system.bin ...] config.json [config.json ...]\n"
+                  << "Times each linear solver configuration on each binary linear system written by flow\n"
+                  << "with --linear-system-dump-format=binary and --linear-solver-verbosity=11.\n"
+                  << "Setup includes building the preconditioner, update is a numerical\n"
+                  << "preconditioner update, and mem is the change in resident memory during setup.\n";
+        return EXIT_FAILURE;
+    }
+
+    try {
+        for (const auto& systemFile : systemFiles) {
+            switch (Opm::binaryLinearSystemBlockSize(systemFile)) {
+            case 1: benchmark<1>(systemFile, configFiles, pressureIndex); break;
+            case 2: benchmark<2>(systemFile, configFiles, pressureIndex); break;
+            case 3: benchmark<3>(systemFile, configFiles, pressureIndex); break;
+            case 4: benchmark<4>(systemFile, configFiles, pressureIndex); break;
+            default:
+                std::cerr << systemFile << ": unsupported block size.\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
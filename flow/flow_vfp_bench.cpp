@@ -0,0 +1,190 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "config.h"
+
+// Times bhp lookups in production VFP tables, e.g. the ones in
+// tests/VFPPROD1 and tests/VFPPROD2.
+//
+// Usage: flow_vfp_bench [--points=N] file [file ...]
+//
+// Every file must be a deck with one or more VFPPROD keywords. For each
+// table, N points are evaluated in two orders: a smooth sweep through the
+// table, as in the bhp/thp limit solves for one well, and a random order.
+// Each order is timed with plain lookups, with lookups that reuse the
+// previous interpolation intervals, and with the batched interface.
+
+#include <opm/simulators/wells/VFPHelpers.hpp>
+#include <opm/simulators/wells/VFPProdProperties.hpp>
+
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+
+#include <dune/common/timer.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Points
+{
+    std::vector<double> aqua;
+    std::vector<double> liquid;
+    std::vector<double> vapour;
+    std::vector<double> thp;
+    std::vector<double> alq;
+};
+
+// Points covering the axis ranges of the table (and a bit beyond). The
+// phase rates are built assuming LIQ/WCT/GOR axes, other tables will be
+// sampled with a different distribution, which is fine for timing.
+Points sweepPoints(const Opm::VFPProdTable& table, const std::size_t n)
+{
+    auto at = [](const std::vector<double>& axis, const double s) {
+        return axis.front() + s * 1.1 * (axis.back() - axis.front());
+    };
+    Points p;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double s = static_cast<double>(i) / n;
+        const double liq = -at(table.getFloAxis(), s);
+        const double wct = std::clamp(at(table.getWFRAxis(), s), 0.0, 1.0);
+        p.aqua.push_back(wct * liq);
+        p.liquid.push_back(liq - wct * liq);
+        p.vapour.push_back(at(table.getGFRAxis(), 1.0 - s) * p.liquid.back());
+        p.thp.push_back(at(table.getTHPAxis(), s));
+        p.alq.push_back(at(table.getALQAxis(), s));
+    }
+    return p;
+}
+
+Points shuffled(const Points& p)
+{
+    std::vector<std::size_t> order(p.aqua.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    Points q;
+    for (const auto i : order) {
+        q.aqua.push_back(p.aqua[i]);
+        q.liquid.push_back(p.liquid[i]);
+        q.vapour.push_back(p.vapour[i]);
+        q.thp.push_back(p.thp[i]);
+        q.alq.push_back(p.alq[i]);
+    }
+    return q;
+}
+
+void benchmark(const Opm::VFPProdProperties& properties,
+               const int tableId,
+               const std::string& name,
+               const Points& p)
+{
+    const std::size_t n = p.aqua.size();
+    Dune::Timer timer;
+
+    double sum = 0.0;
+    timer.reset();
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += properties.bhp(tableId, p.aqua[i], p.liquid[i], p.vapour[i], p.thp[i], p.alq[i]);
+    }
+    const double plain = timer.elapsed();
+
+    Opm::detail::VFPInterpCache cache;
+    double sumCached = 0.0;
+    timer.reset();
+    for (std::size_t i = 0; i < n; ++i) {
+        sumCached += properties.bhp(tableId, p.aqua[i], p.liquid[i], p.vapour[i], p.thp[i], p.alq[i], cache);
+    }
+    const double cached = timer.elapsed();
+
+    timer.reset();
+    const auto bhps = properties.bhp(tableId, p.aqua, p.liquid, p.vapour, p.thp, p.alq);
+    const double batched = timer.elapsed();
+    double sumBatched = 0.0;
+    for (const auto bhp : bhps) {
+        sumBatched += bhp;
+    }
+
+    const double toNs = 1.0e9 / n;
+    std::cout << fmt::format("  {:<8} {:12.1f} {:12.1f} {:12.1f} {:>10}\n",
+                             name, plain * toNs, cached * toNs, batched * toNs,
+                             (sum == sumCached && sum == sumBatched) ? "yes" : "NO");
+}
+
+} // anonymous namespace
+
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> files;
+    std::size_t numPoints = 1000000;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        if (arg.rfind("--points=", 0) == 0) {
+            numPoints = std::stoul(arg.substr(9));
+        } else {
+            files.push_back(arg);
+        }
+    }
+    if (files.empty() || numPoints == 0) {
+        std::cerr << "Usage: " << argv[0] << " [--points=1000000] file [file ...]\n"
+                  << "Times bhp lookups in the VFPPROD tables of each file, e.g. tests/VFPPROD1\n"
+                  << "and tests/VFPPROD2. Times are in ns per lookup, for plain lookups, lookups\n"
+                  << "reusing the previous intervals and the batched interface.\n";
+        return EXIT_FAILURE;
+    }
+
+    try {
+        Opm::Parser parser;
+        for (const auto& file : files) {
+            const auto deck = parser.parseFile(file);
+            const auto& units = deck.getActiveUnitSystem();
+            for (std::size_t k = 0; k < deck.count("VFPPROD"); ++k) {
+                const Opm::VFPProdTable table(deck.getKeyword("VFPPROD", k), units);
+                Opm::VFPProdProperties properties;
+                properties.addTable(table);
+
+                std::cout << fmt::format("{}: table {}, {} x {} x {} x {} x {} (flo x thp x wfr x gfr x alq)\n",
+                                         file, table.getTableNum(),
+                                         table.getFloAxis().size(), table.getTHPAxis().size(),
+                                         table.getWFRAxis().size(), table.getGFRAxis().size(),
+                                         table.getALQAxis().size());
+                std::cout << fmt::format("  {:<8} {:>12} {:>12} {:>12} {:>10}\n",
+                                         "order", "plain", "cached", "batched", "agree");
+                const Points sweep = sweepPoints(table, numPoints);
+                benchmark(properties, table.getTableNum(), "sweep", sweep);
+                benchmark(properties, table.getTableNum(), "random", shuffled(sweep));
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
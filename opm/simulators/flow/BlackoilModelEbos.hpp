@@ -25,6 +25,7 @@
 #define OPM_BLACKOILMODELEBOS_HEADER_INCLUDED
 
 #include <ebos/eclproblem.hh>
+#include <opm/models/parallel/threadedentityiterator.hh>
 #include <opm/models/utils/start.hh>
 
 #include <opm/simulators/timestepping/AdaptiveTimeSteppingEbos.hpp>
@@ -153,6 +154,7 @@ namespace Opm {
 
         using Simulator = GetPropType<TypeTag, Properties::Simulator>;
         using Grid = GetPropType<TypeTag, Properties::Grid>;
+        using GridView = GetPropType<TypeTag, Properties::GridView>;
         using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
         using SparseMatrixAdapter = GetPropType<TypeTag, Properties::SparseMatrixAdapter>;
         using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
@@ -284,6 +286,7 @@ namespace Opm {
                 // For each iteration we store in a vector the norms of the residual of
                 // the mass balance for each active phase, the well flux and the well equations.
                 residual_norms_history_.clear();
+                forcing_term_ = param_.eisenstat_walker_max_tolerance_;
                 current_relaxation_ = 1.0;
                 dx_old_ = 0.0;
                 convergence_reports_.push_back({timer.reportStepNum(), timer.currentStepNum(), {}});
@@ -327,8 +330,14 @@ namespace Opm {
                 perfTimer.start();
                 report.total_newton_iterations = 1;
 
-                // enable single precision for solvers when dt is smaller then 20 days
-                //residual_.singlePrecision = (unit::convert::to(dt, unit::day) < 20.) ;
+                // enable single precision preconditioning when dt is smaller than MaxSinglePrecisionDays
+                auto& linearSolver = ebosSimulator_.model().newtonMethod().linearSolver();
+                linearSolver.setSinglePrecision(timer.currentStepLength() < param_.maxSinglePrecisionTimeStep_);
+
+                // inexact Newton: relax the linear tolerance while the nonlinear residual is large
+                const double forcingTerm = param_.use_eisenstat_walker_
+                    ? eisenstatWalkerForcingTerm(linearSolver.tolerance()) : 0.0;
+                linearSolver.setForcingTerm(forcingTerm);
 
                 // Compute the nonlinear update.
                 const int nc = UgGridHelpers::numCells(grid_);
@@ -346,11 +355,21 @@ namespace Opm {
                     report.linear_solve_setup_time += linear_solve_setup_time_;
                     report.linear_solve_time += perfTimer.stop();
                     report.total_linear_iterations += linearIterationsLastSolve();
+                    if (linearSolver.singlePrecision()) {
+                        report.total_single_precision_linear_solves += 1;
+                        report.total_single_precision_linear_iterations += linearIterationsLastSolve();
+                    }
+                    report.total_saved_linear_iterations
+                        += estimatedSavedLinearIterations(forcingTerm, linearSolver.tolerance());
                 }
                 catch (...) {
                     report.linear_solve_setup_time += linear_solve_setup_time_;
                     report.linear_solve_time += perfTimer.stop();
                     report.total_linear_iterations += linearIterationsLastSolve();
+                    if (linearSolver.singlePrecision()) {
+                        report.total_single_precision_linear_solves += 1;
+                        report.total_single_precision_linear_iterations += linearIterationsLastSolve();
+                    }
 
                     failureReport_ += report;
                     throw; // re-throw up
@@ -517,6 +536,53 @@ namespace Opm {
         }
 
 
+        /// Eisenstat-Walker forcing term (choice 2, gamma = 0.9, alpha = 2) for the
+        /// linear solve of the current Newton iteration. It is computed from the
+        /// reduction of the largest CNV residual over the last Newton iteration,
+        /// and bounded by the configured linear tolerance and
+        /// --eisenstat-walker-max-tolerance.
+        double eisenstatWalkerForcingTerm(const double minTolerance)
+        {
+            const double maxTolerance = std::max(param_.eisenstat_walker_max_tolerance_, minTolerance);
+            const auto num = residual_norms_history_.size();
+            if (num < 2) {
+                forcing_term_ = maxTolerance;
+                return forcing_term_;
+            }
+            const auto maxNorm = [](const std::vector<double>& norms) {
+                return norms.empty() ? 0.0 : *std::max_element(norms.begin(), norms.end());
+            };
+            const double previous = maxNorm(residual_norms_history_[num - 2]);
+            const double current = maxNorm(residual_norms_history_[num - 1]);
+            if (!(previous > 0.0)) {
+                forcing_term_ = minTolerance;
+                return forcing_term_;
+            }
+            constexpr double gamma = 0.9;
+            constexpr double alpha = 2.0;
+            double eta = gamma * std::pow(current / previous, alpha);
+            // Safeguard against a too rapid decrease of the forcing term.
+            const double safeguard = gamma * std::pow(forcing_term_, alpha);
+            if (safeguard > 0.1) {
+                eta = std::max(eta, safeguard);
+            }
+            forcing_term_ = std::clamp(eta, minTolerance, maxTolerance);
+            return forcing_term_;
+        }
+
+        /// Estimate of the linear iterations saved by solving the last linear
+        /// system to forcingTerm rather than to tolerance, assuming the residual
+        /// reduction per iteration stays the same.
+        unsigned int estimatedSavedLinearIterations(const double forcingTerm, const double tolerance) const
+        {
+            const int its = linearIterationsLastSolve();
+            if (its <= 0 || !(forcingTerm > tolerance) || !(forcingTerm < 1.0)) {
+                return 0;
+            }
+            const double itsToTolerance = its * std::log(tolerance) / std::log(forcingTerm);
+            return static_cast<unsigned int>(std::max(0.0, std::round(itsToTolerance - its)));
+        }
+
         /// Number of linear iterations used in last call to solveJacobianSystem().
         int linearIterationsLastSolve() const
         {
@@ -629,100 +695,132 @@ namespace Opm {
             return pvSum;
         }
 
-        // Get reservoir quantities on this process needed for convergence calculations.
-        double localConvergenceData(std::vector<Scalar>& R_sum,
-                                    std::vector<Scalar>& maxCoeff,
-                                    std::vector<Scalar>& B_avg)
+        // Store the pore volume, the residuals and the inverse formation
+        // volume factors needed by the convergence calculations for every
+        // interior cell on this process, and the pore volume and residuals
+        // of the border cells, which are included in the CNV pore volume.
+        // This is the only pass over the cells, it may be done by several
+        // threads since each cell is only written by the thread visiting it.
+        void updateConvergenceCellData()
         {
-            double pvSumLocal = 0.0;
             const auto& ebosModel = ebosSimulator_.model();
             const auto& ebosProblem = ebosSimulator_.problem();
-
-            const auto& ebosResid = ebosSimulator_.model().linearizer().residual();
-
-            ElementContext elemCtx(ebosSimulator_);
+            const auto& ebosResid = ebosModel.linearizer().residual();
             const auto& gridView = ebosSimulator().gridView();
-            const auto& elemEndIt = gridView.template end</*codim=*/0, Dune::Interior_Partition>();
 
-            for (auto elemIt = gridView.template begin</*codim=*/0, Dune::Interior_Partition>();
-                 elemIt != elemEndIt;
-                 ++elemIt)
+            if (interior_border_cells_.empty()) {
+                const auto& elemMapper = ebosModel.elementMapper();
+                for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+                    interior_cells_.push_back(elemMapper.index(elem));
+                }
+                for (const auto& elem : elements(gridView, Dune::Partitions::interiorBorder)) {
+                    interior_border_cells_.push_back(elemMapper.index(elem));
+                }
+            }
+            const std::size_t numCells = ebosModel.numGridDof();
+            cnv_pv_.resize(numCells);
+            cnv_residual_.resize(numCells * numEq);
+            cnv_b_.resize(numCells * numEq);
+
+            ThreadedEntityIterator<GridView, /*codim=*/0> threadedElemIt(gridView);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
             {
-                const auto& elem = *elemIt;
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-                const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const auto& fs = intQuants.fluidState();
+                ElementContext elemCtx(ebosSimulator_);
+                auto elemIt = threadedElemIt.beginParallel();
+                for (; !threadedElemIt.isFinished(elemIt); elemIt = threadedElemIt.increment()) {
+                    const auto& elem = *elemIt;
+                    const auto partitionType = elem.partitionType();
+                    if (partitionType != Dune::InteriorEntity && partitionType != Dune::BorderEntity) {
+                        continue;
+                    }
+                    elemCtx.updatePrimaryStencil(elem);
+                    const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
 
-                const double pvValue = ebosProblem.referencePorosity(cell_idx, /*timeIdx=*/0) * ebosModel.dofTotalVolume( cell_idx );
-                pvSumLocal += pvValue;
+                    cnv_pv_[cell_idx] = ebosProblem.referencePorosity(cell_idx, /*timeIdx=*/0) * ebosModel.dofTotalVolume( cell_idx );
+                    Scalar* R = &cnv_residual_[cell_idx * numEq];
+                    for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+                        R[eqIdx] = ebosResid[cell_idx][eqIdx];
+                    }
 
-                for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx)
-                {
-                    if (!FluidSystem::phaseIsActive(phaseIdx)) {
+                    // the border cells do not enter the sums and averages
+                    if (partitionType != Dune::InteriorEntity) {
                         continue;
                     }
+                    elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+                    const auto& intQuants = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
+                    const auto& fs = intQuants.fluidState();
+                    Scalar* B = &cnv_b_[cell_idx * numEq];
 
-                    const unsigned compIdx = Indices::canonicalToActiveComponentIndex(FluidSystem::solventComponentIndex(phaseIdx));
+                    for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx)
+                    {
+                        if (!FluidSystem::phaseIsActive(phaseIdx)) {
+                            continue;
+                        }
 
-                    B_avg[ compIdx ] += 1.0 / fs.invB(phaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][compIdx];
+                        const unsigned compIdx = Indices::canonicalToActiveComponentIndex(FluidSystem::solventComponentIndex(phaseIdx));
+                        B[ compIdx ] = 1.0 / fs.invB(phaseIdx).value();
+                    }
 
-                    R_sum[ compIdx ] += R2;
-                    maxCoeff[ compIdx ] = std::max( maxCoeff[ compIdx ], std::abs( R2 ) / pvValue );
+                    if constexpr (has_solvent_) {
+                        B[ contiSolventEqIdx ] = 1.0 / intQuants.solventInverseFormationVolumeFactor().value();
+                    }
+                    if constexpr (has_extbo_) {
+                        B[ contiZfracEqIdx ] = 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
+                    }
+                    if constexpr (has_polymer_) {
+                        B[ contiPolymerEqIdx ] = 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
+                    }
+                    if constexpr (has_foam_) {
+                        B[ contiFoamEqIdx ] = 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
+                    }
+                    if constexpr (has_brine_) {
+                        B[ contiBrineEqIdx ] = 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
+                    }
+                    if constexpr (has_polymermw_) {
+                        static_assert(has_polymer_);
+                        B[ contiPolymerMWEqIdx ] = 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
+                    }
+                    if constexpr (has_energy_) {
+                        B[ contiEnergyEqIdx ] = 1.0;
+                    }
                 }
+            }
+        }
 
-                if constexpr (has_solvent_) {
-                    B_avg[ contiSolventEqIdx ] += 1.0 / intQuants.solventInverseFormationVolumeFactor().value();
-                    const auto R2 = ebosResid[cell_idx][contiSolventEqIdx];
-                    R_sum[ contiSolventEqIdx ] += R2;
-                    maxCoeff[ contiSolventEqIdx ] = std::max( maxCoeff[ contiSolventEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_extbo_) {
-                    B_avg[ contiZfracEqIdx ] += 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiZfracEqIdx];
-                    R_sum[ contiZfracEqIdx ] += R2;
-                    maxCoeff[ contiZfracEqIdx ] = std::max( maxCoeff[ contiZfracEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_polymer_) {
-                    B_avg[ contiPolymerEqIdx ] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiPolymerEqIdx];
-                    R_sum[ contiPolymerEqIdx ] += R2;
-                    maxCoeff[ contiPolymerEqIdx ] = std::max( maxCoeff[ contiPolymerEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_foam_) {
-                    B_avg[ contiFoamEqIdx ] += 1.0 / fs.invB(FluidSystem::gasPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiFoamEqIdx];
-                    R_sum[ contiFoamEqIdx ] += R2;
-                    maxCoeff[ contiFoamEqIdx ] = std::max( maxCoeff[ contiFoamEqIdx ], std::abs( R2 ) / pvValue );
-                }
-                if constexpr (has_brine_) {
-                    B_avg[ contiBrineEqIdx ] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
-                    const auto R2 = ebosResid[cell_idx][contiBrineEqIdx];
-                    R_sum[ contiBrineEqIdx ] += R2;
-                    maxCoeff[ contiBrineEqIdx ] = std::max( maxCoeff[ contiBrineEqIdx ], std::abs( R2 ) / pvValue );
-                }
+        // Get reservoir quantities on this process needed for convergence calculations.
+        double localConvergenceData(std::vector<Scalar>& R_sum,
+                                    std::vector<Scalar>& maxCoeff,
+                                    std::vector<Scalar>& B_avg)
+        {
+            updateConvergenceCellData();
 
-                if constexpr (has_polymermw_) {
-                    static_assert(has_polymer_);
-
-                    B_avg[contiPolymerMWEqIdx] += 1.0 / fs.invB(FluidSystem::waterPhaseIdx).value();
-                    // the residual of the polymer molecular equation is scaled down by a 100, since molecular weight
-                    // can be much bigger than 1, and this equation shares the same tolerance with other mass balance equations
-                    // TODO: there should be a more general way to determine the scaling-down coefficient
-                    const auto R2 = ebosResid[cell_idx][contiPolymerMWEqIdx] / 100.;
-                    R_sum[contiPolymerMWEqIdx] += R2;
-                    maxCoeff[contiPolymerMWEqIdx] = std::max( maxCoeff[contiPolymerMWEqIdx], std::abs( R2 ) / pvValue );
-                }
+            // The sums are taken in the same cell order as the grid traversal,
+            // independently of how the cells were distributed on threads.
+            double pvSumLocal = 0.0;
+            for (const unsigned cell_idx : interior_cells_)
+            {
+                const double pvValue = cnv_pv_[cell_idx];
+                pvSumLocal += pvValue;
 
-                if constexpr (has_energy_) {
-                    B_avg[ contiEnergyEqIdx ] += 1.0;
-                    const auto R2 = ebosResid[cell_idx][contiEnergyEqIdx];
-                    R_sum[ contiEnergyEqIdx ] += R2;
-                    maxCoeff[ contiEnergyEqIdx ] = std::max( maxCoeff[ contiEnergyEqIdx ], std::abs( R2 ) / pvValue );
+                const Scalar* R = &cnv_residual_[cell_idx * numEq];
+                const Scalar* B = &cnv_b_[cell_idx * numEq];
+                for (int compIdx = 0; compIdx < numEq; ++compIdx)
+                {
+                    auto R2 = R[ compIdx ];
+                    if constexpr (has_polymermw_) {
+                        // the residual of the polymer molecular equation is scaled down by a 100, since molecular weight
+                        // can be much bigger than 1, and this equation shares the same tolerance with other mass balance equations
+                        // TODO: there should be a more general way to determine the scaling-down coefficient
+                        if (compIdx == contiPolymerMWEqIdx) {
+                            R2 /= 100.;
+                        }
+                    }
+                    B_avg[ compIdx ] += B[ compIdx ];
+                    R_sum[ compIdx ] += R2;
+                    maxCoeff[ compIdx ] = std::max( maxCoeff[ compIdx ], std::abs( R2 ) / pvValue );
                 }
-
             }
 
             // compute local average in terms of global number of elements
@@ -735,28 +833,22 @@ namespace Opm {
             return pvSumLocal;
         }
 
+        // Pore volume of the interior and border cells violating the CNV
+        // tolerance, using the cell data stored by localConvergenceData().
         double computeCnvErrorPv(const std::vector<Scalar>& B_avg, double dt)
         {
             double errorPV{};
-            const auto& ebosModel = ebosSimulator_.model();
-            const auto& ebosProblem = ebosSimulator_.problem();
-            const auto& ebosResid = ebosSimulator_.model().linearizer().residual();
-            const auto& gridView = ebosSimulator().gridView();
-            ElementContext elemCtx(ebosSimulator_);
 
-            for (const auto& elem: elements(gridView, Dune::Partitions::interiorBorder))
+            for (const unsigned cell_idx : interior_border_cells_)
             {
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-                const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-                const double pvValue = ebosProblem.referencePorosity(cell_idx, /*timeIdx=*/0) * ebosModel.dofTotalVolume( cell_idx );
-                const auto& cellResidual = ebosResid[cell_idx];
+                const double pvValue = cnv_pv_[cell_idx];
+                const Scalar* R = &cnv_residual_[cell_idx * numEq];
                 bool cnvViolated = false;
 
-                for (unsigned eqIdx = 0; eqIdx < cellResidual.size(); ++eqIdx)
+                for (int eqIdx = 0; eqIdx < numEq; ++eqIdx)
                 {
                     using std::abs;
-                    Scalar CNV = cellResidual[eqIdx] * dt * B_avg[eqIdx] / pvValue;
+                    Scalar CNV = R[eqIdx] * dt * B_avg[eqIdx] / pvValue;
                     cnvViolated = cnvViolated || (abs(CNV) > param_.tolerance_cnv_);
                 }
 
@@ -997,8 +1089,18 @@ namespace Opm {
         /// \brief The number of cells of the global grid.
         long int global_nc_;
 
+        // Interior and interior plus border cells of this process, and the
+        // pore volume, residuals and inverse formation volume factors per
+        // cell used by the convergence checks, see updateConvergenceCellData().
+        std::vector<unsigned> interior_cells_;
+        std::vector<unsigned> interior_border_cells_;
+        std::vector<Scalar> cnv_pv_;
+        std::vector<Scalar> cnv_residual_;
+        std::vector<Scalar> cnv_b_;
+
         std::vector<std::vector<double>> residual_norms_history_;
         double current_relaxation_;
+        double forcing_term_ = 0.0;
         BVector dx_old_;
 
         std::vector<StepReport> convergence_reports_;
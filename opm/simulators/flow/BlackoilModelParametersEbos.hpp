@@ -100,10 +100,22 @@ struct UseUpdateStabilization {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct UseEisenstatWalker {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct EisenstatWalkerMaxTolerance {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct MatrixAddWellContributions {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct UseBatchedWellContributions {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct EnableWellOperabilityCheck {
     using type = UndefinedProperty;
 };
@@ -229,10 +241,23 @@ struct UseUpdateStabilization<TypeTag, TTag::FlowModelParameters> {
     static constexpr bool value = true;
 };
 template<class TypeTag>
+struct UseEisenstatWalker<TypeTag, TTag::FlowModelParameters> {
+    static constexpr bool value = false;
+};
+template<class TypeTag>
+struct EisenstatWalkerMaxTolerance<TypeTag, TTag::FlowModelParameters> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 0.1;
+};
+template<class TypeTag>
 struct MatrixAddWellContributions<TypeTag, TTag::FlowModelParameters> {
     static constexpr bool value = false;
 };
 template<class TypeTag>
+struct UseBatchedWellContributions<TypeTag, TTag::FlowModelParameters> {
+    static constexpr bool value = false;
+};
+template<class TypeTag>
 struct TolerancePressureMsWells<TypeTag, TTag::FlowModelParameters> {
     using type = GetPropType<TypeTag, Scalar>;
     static constexpr type value = 0.01*1e5;
@@ -374,6 +399,13 @@ namespace Opm
         /// Try to detect oscillation or stagnation.
         bool use_update_stabilization_;
 
+        /// Choose the linear solver tolerance of each Newton iteration from the
+        /// reduction of the nonlinear residual (Eisenstat-Walker forcing term).
+        bool use_eisenstat_walker_;
+
+        /// Upper bound for the Eisenstat-Walker linear solver tolerance.
+        double eisenstat_walker_max_tolerance_;
+
         /// Whether to use MultisegmentWell to handle multisegment wells
         /// it is something temporary before the multisegment well model is considered to be
         /// well developed and tested.
@@ -387,6 +419,10 @@ namespace Opm
         // Whether to add influences of wells between cells to the matrix and preconditioner matrix
         bool matrix_add_well_contributions_;
 
+        // Whether to pack the contributions of all standard wells into one
+        // structure that is applied in a single loop by the linear operator
+        bool use_batched_well_contributions_;
+
         /// Construct from user parameters or defaults.
         BlackoilModelParametersEbos()
         {
@@ -416,7 +452,10 @@ namespace Opm
             solve_welleq_initially_ = EWOMS_GET_PARAM(TypeTag, bool, SolveWelleqInitially);
             update_equations_scaling_ = EWOMS_GET_PARAM(TypeTag, bool, UpdateEquationsScaling);
             use_update_stabilization_ = EWOMS_GET_PARAM(TypeTag, bool, UseUpdateStabilization);
+            use_eisenstat_walker_ = EWOMS_GET_PARAM(TypeTag, bool, UseEisenstatWalker);
+            eisenstat_walker_max_tolerance_ = EWOMS_GET_PARAM(TypeTag, Scalar, EisenstatWalkerMaxTolerance);
             matrix_add_well_contributions_ = EWOMS_GET_PARAM(TypeTag, bool, MatrixAddWellContributions);
+            use_batched_well_contributions_ = EWOMS_GET_PARAM(TypeTag, bool, UseBatchedWellContributions);
 
             deck_file_name_ = EWOMS_GET_PARAM(TypeTag, std::string, EclDeckFileName);
         }
@@ -451,7 +490,10 @@ namespace Opm
             EWOMS_REGISTER_PARAM(TypeTag, bool, SolveWelleqInitially, "Fully solve the well equations before each iteration of the reservoir model");
             EWOMS_REGISTER_PARAM(TypeTag, bool, UpdateEquationsScaling, "Update scaling factors for mass balance equations during the run");
             EWOMS_REGISTER_PARAM(TypeTag, bool, UseUpdateStabilization, "Try to detect and correct oscillations or stagnation during the Newton method");
+            EWOMS_REGISTER_PARAM(TypeTag, bool, UseEisenstatWalker, "Relax the linear solver tolerance when the nonlinear residual is still large, using the Eisenstat-Walker forcing term computed from the residual reduction of the previous Newton iterations");
+            EWOMS_REGISTER_PARAM(TypeTag, Scalar, EisenstatWalkerMaxTolerance, "Largest linear solver tolerance allowed by --use-eisenstat-walker");
             EWOMS_REGISTER_PARAM(TypeTag, bool, MatrixAddWellContributions, "Explicitly specify the influences of wells between cells in the Jacobian and preconditioner matrices");
+            EWOMS_REGISTER_PARAM(TypeTag, bool, UseBatchedWellContributions, "Pack the B, C and D^-1 blocks of all standard wells into contiguous arrays after assembly and apply them in a single loop in the linear solver. Ignored with --matrix-add-well-contributions=true");
             EWOMS_REGISTER_PARAM(TypeTag, bool, EnableWellOperabilityCheck, "Enable the well operability checking");
         }
     };
@@ -0,0 +1,261 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_BINARYLINEARSYSTEM_HEADER_INCLUDED
+#define OPM_BINARYLINEARSYSTEM_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm
+{
+
+/// A linear system as written by writeBinaryLinearSystem().
+///
+/// The file format is a compact block-CSR format in native byte order:
+///
+///     char[8]   magic "OPMLSYS1"
+///     uint32    block size bs
+///     uint32    flags (1: well contribution matrix, 2: weights)
+///     matrix    the reservoir matrix
+///     double    rhs, N*bs values
+///     matrix    the well contributions (if flag 1)
+///     double    quasi-IMPES weights, N*bs values (if flag 2)
+///
+/// where each matrix is stored as
+///
+///     uint64    number of block rows N, number of block nonzeros nnz
+///     uint64    row start offsets, N+1 values
+///     uint32    block column indices, nnz values
+///     double    block values, nnz*bs*bs values, row major within a block
+///
+/// The well contribution matrix holds -C^T D^-1 B for all wells. It is
+/// only present if the wells were not included in the reservoir matrix,
+/// in which case the system to solve is (matrix + wells) x = rhs.
+template <int bs>
+struct BinaryLinearSystem
+{
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bs, bs>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bs>>;
+
+    Matrix matrix;
+    Vector rhs;
+    bool hasWells = false;
+    Matrix wells;
+    Vector weights;
+};
+
+namespace Detail
+{
+    constexpr char binaryLinearSystemMagic[8] = {'O', 'P', 'M', 'L', 'S', 'Y', 'S', '1'};
+    constexpr std::uint32_t binaryLinearSystemHasWells = 1;
+    constexpr std::uint32_t binaryLinearSystemHasWeights = 2;
+
+    template <class T>
+    void writeBinary(std::ostream& os, const T* data, std::size_t count)
+    {
+        os.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    }
+
+    template <class T>
+    void readBinary(std::istream& is, T* data, std::size_t count)
+    {
+        is.read(reinterpret_cast<char*>(data), count * sizeof(T));
+        if (!is) {
+            OPM_THROW(std::runtime_error, "Unexpected end of binary linear system file.");
+        }
+    }
+
+    template <class Matrix>
+    void writeBinaryMatrix(std::ostream& os, const Matrix& matrix)
+    {
+        const std::uint64_t sizes[2] = {matrix.N(), matrix.nonzeroes()};
+        writeBinary(os, sizes, 2);
+
+        std::vector<std::uint64_t> rowStart;
+        std::vector<std::uint32_t> cols;
+        rowStart.reserve(matrix.N() + 1);
+        cols.reserve(matrix.nonzeroes());
+        rowStart.push_back(0);
+        for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                cols.push_back(col.index());
+            }
+            rowStart.push_back(cols.size());
+        }
+        writeBinary(os, rowStart.data(), rowStart.size());
+        writeBinary(os, cols.data(), cols.size());
+
+        // Blocks may be Opm::MatrixBlock rather than FieldMatrix, so copy entry-wise.
+        using Block = typename Matrix::block_type;
+        std::vector<double> values(Block::rows * Block::cols);
+        for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                for (int i = 0; i < Block::rows; ++i) {
+                    for (int j = 0; j < Block::cols; ++j) {
+                        values[i * Block::cols + j] = (*col)[i][j];
+                    }
+                }
+                writeBinary(os, values.data(), values.size());
+            }
+        }
+    }
+
+    template <class Matrix>
+    void readBinaryMatrix(std::istream& is, Matrix& matrix)
+    {
+        std::uint64_t sizes[2];
+        readBinary(is, sizes, 2);
+        const auto n = sizes[0];
+        const auto nnz = sizes[1];
+        std::vector<std::uint64_t> rowStart(n + 1);
+        std::vector<std::uint32_t> cols(nnz);
+        readBinary(is, rowStart.data(), rowStart.size());
+        readBinary(is, cols.data(), cols.size());
+
+        matrix.setSize(n, n, nnz);
+        matrix.setBuildMode(Matrix::row_wise);
+        std::size_t row = 0;
+        for (auto it = matrix.createbegin(); it != matrix.createend(); ++it, ++row) {
+            for (auto k = rowStart[row]; k < rowStart[row + 1]; ++k) {
+                it.insert(cols[k]);
+            }
+        }
+
+        using Block = typename Matrix::block_type;
+        for (auto r = matrix.begin(); r != matrix.end(); ++r) {
+            for (auto col = r->begin(); col != r->end(); ++col) {
+                readBinary(is, &(*col)[0][0], Block::rows * Block::cols);
+            }
+        }
+    }
+
+    template <class Vector>
+    void writeBinaryVector(std::ostream& os, const Vector& v)
+    {
+        for (const auto& block : v) {
+            for (const auto& value : block) {
+                writeBinary(os, &value, 1);
+            }
+        }
+    }
+
+    template <class Vector>
+    void readBinaryVector(std::istream& is, Vector& v, std::size_t n)
+    {
+        v.resize(n);
+        for (auto& block : v) {
+            readBinary(is, &block[0], block.size());
+        }
+    }
+} // namespace Detail
+
+
+/// Write a linear system in the binary block-CSR format described at
+/// BinaryLinearSystem. Pass nullptr for the parts that are not available.
+template <class Matrix, class Vector>
+void writeBinaryLinearSystem(const std::string& filename,
+                             const Matrix& matrix,
+                             const Vector& rhs,
+                             const Matrix* wells,
+                             const Vector* weights)
+{
+    std::ofstream os(filename, std::ios::binary);
+    if (!os) {
+        OPM_THROW(std::runtime_error, "Could not open " << filename << " for writing.");
+    }
+    const std::uint32_t header[2] = {
+        static_cast<std::uint32_t>(Matrix::block_type::rows),
+        (wells ? Detail::binaryLinearSystemHasWells : 0u) | (weights ? Detail::binaryLinearSystemHasWeights : 0u)
+    };
+    Detail::writeBinary(os, Detail::binaryLinearSystemMagic, 8);
+    Detail::writeBinary(os, header, 2);
+    Detail::writeBinaryMatrix(os, matrix);
+    Detail::writeBinaryVector(os, rhs);
+    if (wells) {
+        Detail::writeBinaryMatrix(os, *wells);
+    }
+    if (weights) {
+        Detail::writeBinaryVector(os, *weights);
+    }
+}
+
+/// Return the block size of the linear system stored in filename.
+inline int binaryLinearSystemBlockSize(const std::string& filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is) {
+        OPM_THROW(std::runtime_error, "Could not open " << filename << " for reading.");
+    }
+    char magic[8];
+    std::uint32_t header[2];
+    Detail::readBinary(is, magic, 8);
+    if (std::memcmp(magic, Detail::binaryLinearSystemMagic, 8) != 0) {
+        OPM_THROW(std::runtime_error, filename << " is not a binary linear system file.");
+    }
+    Detail::readBinary(is, header, 2);
+    return header[0];
+}
+
+/// Read a linear system written by writeBinaryLinearSystem().
+template <int bs>
+BinaryLinearSystem<bs> readBinaryLinearSystem(const std::string& filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is) {
+        OPM_THROW(std::runtime_error, "Could not open " << filename << " for reading.");
+    }
+    char magic[8];
+    std::uint32_t header[2];
+    Detail::readBinary(is, magic, 8);
+    if (std::memcmp(magic, Detail::binaryLinearSystemMagic, 8) != 0) {
+        OPM_THROW(std::runtime_error, filename << " is not a binary linear system file.");
+    }
+    Detail::readBinary(is, header, 2);
+    if (header[0] != bs) {
+        OPM_THROW(std::runtime_error, filename << " has block size " << header[0] << ", expected " << bs << ".");
+    }
+
+    BinaryLinearSystem<bs> system;
+    Detail::readBinaryMatrix(is, system.matrix);
+    Detail::readBinaryVector(is, system.rhs, system.matrix.N());
+    if (header[1] & Detail::binaryLinearSystemHasWells) {
+        system.hasWells = true;
+        Detail::readBinaryMatrix(is, system.wells);
+    }
+    if (header[1] & Detail::binaryLinearSystemHasWeights) {
+        Detail::readBinaryVector(is, system.weights, system.matrix.N());
+    }
+    return system;
+}
+
+} // namespace Opm
+
+#endif // OPM_BINARYLINEARSYSTEM_HEADER_INCLUDED
@@ -22,7 +22,9 @@
 #define OPM_FLEXIBLE_SOLVER_IMPL_HEADER_INCLUDED
 
 #include <opm/simulators/linalg/FlexibleSolver.hpp>
+#include <opm/simulators/linalg/PipelinedBiCGSTABSolver.hpp>
 #include <opm/simulators/linalg/PreconditionerFactory.hpp>
+#include <opm/simulators/linalg/RecyclingGCRSolver.hpp>
 #include <opm/simulators/linalg/matrixblock.hh>
 
 #include <dune/common/fmatrix.hh>
@@ -140,10 +142,12 @@ namespace Dune
     }
 
     template <class MatrixType, class VectorType>
+    template <class Comm>
     void
     FlexibleSolver<MatrixType, VectorType>::
-    initSolver(const Opm::PropertyTree& prm, const bool is_iorank)
+    initSolver(const Opm::PropertyTree& prm, const Comm& comm)
     {
+        const bool is_iorank = comm.communicator().rank() == 0;
         const double tol = prm.get<double>("tol", 1e-2);
         const int maxiter = prm.get<int>("maxiter", 200);
         const int verbosity = is_iorank ? prm.get<int>("verbosity", 0) : 0;
@@ -155,6 +159,13 @@ namespace Dune
                                                                   tol, // desired residual reduction factor
                                                                   maxiter, // maximum number of iterations
                                                                   verbosity));
+        } else if (solver_type == "pipelined_bicgstab") {
+            linsolver_.reset(new Dune::PipelinedBiCGSTABSolver<VectorType, Comm>(*linearoperator_for_solver_,
+                                                                                *preconditioner_,
+                                                                                comm,
+                                                                                tol,
+                                                                                maxiter,
+                                                                                verbosity));
         } else if (solver_type == "loopsolver") {
             linsolver_.reset(new Dune::LoopSolver<VectorType>(*linearoperator_for_solver_,
                                                               *scalarproduct_,
@@ -171,6 +182,19 @@ namespace Dune
                                                                         restart, // desired residual reduction factor
                                                                         maxiter, // maximum number of iterations
                                                                         verbosity));
+        } else if (solver_type == "recycling_gcr") {
+            // Keeps a small subspace between solves, so this benefits from
+            // the solver being reused over several linear systems.
+            const int restart = prm.get<int>("restart", 30);
+            const int recycle = prm.get<int>("recycle", 5);
+            linsolver_.reset(new Dune::RecyclingGCRSolver<VectorType>(*linearoperator_for_solver_,
+                                                                      *scalarproduct_,
+                                                                      *preconditioner_,
+                                                                      tol,
+                                                                      restart,
+                                                                      recycle,
+                                                                      maxiter,
+                                                                      verbosity));
 #if HAVE_SUITESPARSE_UMFPACK
         } else if (solver_type == "umfpack") {
             bool dummy = false;
@@ -195,7 +219,7 @@ namespace Dune
          std::size_t pressureIndex)
     {
         initOpPrecSp(op, prm, weightsCalculator, comm, pressureIndex);
-        initSolver(prm, comm.communicator().rank() == 0);
+        initSolver(prm, comm);
     }
 
 } // namespace Dune
@@ -137,6 +137,14 @@ template<class TypeTag, class MyTypeTag>
 struct FpgaBitstream {
     using type = UndefinedProperty;
 };
+template<class TypeTag, class MyTypeTag>
+struct LinearSolverMixedPrecision {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct LinearSystemDumpFormat {
+    using type = UndefinedProperty;
+};
 
 template<class TypeTag>
 struct LinearSolverReduction<TypeTag, TTag::FlowIstlSolverParams> {
@@ -236,6 +244,14 @@ template<class TypeTag>
 struct FpgaBitstream<TypeTag, TTag::FlowIstlSolverParams> {
     static constexpr auto value = "";
 };
+template<class TypeTag>
+struct LinearSolverMixedPrecision<TypeTag, TTag::FlowIstlSolverParams> {
+    static constexpr bool value = false;
+};
+template<class TypeTag>
+struct LinearSystemDumpFormat<TypeTag, TTag::FlowIstlSolverParams> {
+    static constexpr auto value = "matrixmarket";
+};
 
 } // namespace Opm::Properties
 
@@ -267,6 +283,8 @@ namespace Opm
         int cpr_reuse_setup_ = 0;
         std::string opencl_ilu_reorder_;
         std::string fpga_bitstream_;
+        bool linear_solver_mixed_precision_;
+        std::string linear_system_dump_format_;
 
         template <class TypeTag>
         void init()
@@ -293,6 +311,8 @@ namespace Opm
             opencl_platform_id_ = EWOMS_GET_PARAM(TypeTag, int, OpenclPlatformId);
             opencl_ilu_reorder_ = EWOMS_GET_PARAM(TypeTag, std::string, OpenclIluReorder);
             fpga_bitstream_ = EWOMS_GET_PARAM(TypeTag, std::string, FpgaBitstream);
+            linear_solver_mixed_precision_ = EWOMS_GET_PARAM(TypeTag, bool, LinearSolverMixedPrecision);
+            linear_system_dump_format_ = EWOMS_GET_PARAM(TypeTag, std::string, LinearSystemDumpFormat);
         }
 
         template <class TypeTag>
@@ -312,13 +332,15 @@ namespace Opm
             EWOMS_REGISTER_PARAM(TypeTag, bool, LinearSolverIgnoreConvergenceFailure, "Continue with the simulation like nothing happened after the linear solver did not converge");
             EWOMS_REGISTER_PARAM(TypeTag, bool, ScaleLinearSystem, "Scale linear system according to equation scale and primary variable types");
             EWOMS_REGISTER_PARAM(TypeTag, int, CprMaxEllIter, "MaxIterations of the elliptic pressure part of the cpr solver");
-            EWOMS_REGISTER_PARAM(TypeTag, int, CprReuseSetup, "Reuse preconditioner setup. Valid options are 0: recreate the preconditioner for every linear solve, 1: recreate once every timestep, 2: recreate if last linear solve took more than 10 iterations, 3: never recreate");
+            EWOMS_REGISTER_PARAM(TypeTag, int, CprReuseSetup, "Reuse preconditioner setup. Valid options are 0: recreate the preconditioner for every linear solve, 1: recreate once every timestep, 2: recreate if last linear solve took more than 10 iterations, 3: never recreate, 4: never recreate and only recompute the numerical values of the CPR preconditioner, keeping its smoother setup, coarse sparsity pattern and AMG aggregates");
             EWOMS_REGISTER_PARAM(TypeTag, std::string, Linsolver, "Configuration of solver. Valid options are: ilu0 (default), cpr (an alias for cpr_trueimpes), cpr_quasiimpes, cpr_trueimpes or amg. Alternatively, you can request a configuration to be read from a JSON file by giving the filename here, ending with '.json.'");
             EWOMS_REGISTER_PARAM(TypeTag, std::string, AcceleratorMode, "Use GPU (cusparseSolver or openclSolver) or FPGA (fpgaSolver) as the linear solver, usage: '--accelerator-mode=[none|cusparse|opencl|fpga|amgcl]'");
             EWOMS_REGISTER_PARAM(TypeTag, int, BdaDeviceId, "Choose device ID for cusparseSolver or openclSolver, use 'nvidia-smi' or 'clinfo' to determine valid IDs");
             EWOMS_REGISTER_PARAM(TypeTag, int, OpenclPlatformId, "Choose platform ID for openclSolver, use 'clinfo' to determine valid platform IDs");
             EWOMS_REGISTER_PARAM(TypeTag, std::string, OpenclIluReorder, "Choose the reordering strategy for ILU for openclSolver and fpgaSolver, usage: '--opencl-ilu-reorder=[level_scheduling|graph_coloring], level_scheduling behaves like Dune and cusparse, graph_coloring is more aggressive and likely to be faster, but is random-based and generally increases the number of linear solves and linear iterations significantly.");
             EWOMS_REGISTER_PARAM(TypeTag, std::string, FpgaBitstream, "Specify the bitstream file for fpgaSolver (including path), usage: '--fpga-bitstream=<filename>'");
+            EWOMS_REGISTER_PARAM(TypeTag, bool, LinearSolverMixedPrecision, "Store the preconditioner in single precision for time steps shorter than --max-single-precision-days, while the Krylov iterations stay in double precision. Supported for the ILU preconditioners, AMG with ILU0 smoother and the CPR fine smoother and coarse AMG");
+            EWOMS_REGISTER_PARAM(TypeTag, std::string, LinearSystemDumpFormat, "Format of the linear systems written when the linear solver verbosity is above 10. Valid options are: matrixmarket (default) or binary (block-CSR, including well contributions and quasi-IMPES weights, readable by flow_linsolve_bench)");
         }
 
         FlowLinearSolverParameters() { reset(); }
@@ -343,6 +365,8 @@ namespace Opm
             opencl_platform_id_       = 0;
             opencl_ilu_reorder_       = "";  // note: the default value is chosen depending on the solver used
             fpga_bitstream_           = "";
+            linear_solver_mixed_precision_ = false;
+            linear_system_dump_format_ = "matrixmarket";
         }
     };
 
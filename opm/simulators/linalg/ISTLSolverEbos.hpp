@@ -245,10 +245,14 @@ namespace Opm
             const int verbosity = prm_.get<int>("verbosity", 0);
             const bool write_matrix = verbosity > 10;
             if (write_matrix) {
-                Helper::writeSystem(simulator_, //simulator is only used to get names
-                                    getMatrix(),
-                                    *rhs_,
-                                    comm_.get());
+                if (parameters_.linear_system_dump_format_ == "binary") {
+                    writeBinarySystem();
+                } else {
+                    Helper::writeSystem(simulator_, //simulator is only used to get names
+                                        getMatrix(),
+                                        *rhs_,
+                                        comm_.get());
+                }
             }
 
             // Solve system.
@@ -293,7 +297,11 @@ namespace Opm
             // Otherwise, use flexible istl solver.
             if (!accelerator_was_used) {
                 assert(flexibleSolver_);
-                flexibleSolver_->apply(x, *rhs_, result);
+                if (forcingTerm_ > tolerance()) {
+                    flexibleSolver_->apply(x, *rhs_, forcingTerm_, result);
+                } else {
+                    flexibleSolver_->apply(x, *rhs_, result);
+                }
             }
 
             // Check convergence, iterations etc.
@@ -312,6 +320,24 @@ namespace Opm
         /// \copydoc NewtonIterationBlackoilInterface::iterations
         int iterations () const { return iterations_; }
 
+        /// Request a single precision preconditioner for the following
+        /// linear solves. Only honoured if --linear-solver-mixed-precision is set.
+        void setSinglePrecision(bool singlePrecision)
+        {
+            singlePrecisionRequested_ = parameters_.linear_solver_mixed_precision_ && singlePrecision;
+        }
+
+        /// Whether the preconditioner of the last solve was stored in single precision.
+        bool singlePrecision() const { return singlePrecision_; }
+
+        /// Request a (looser) residual reduction for the following linear solves,
+        /// typically an inexact Newton forcing term. The configured tolerance is
+        /// used whenever it is larger.
+        void setForcingTerm(double forcingTerm) { forcingTerm_ = forcingTerm; }
+
+        /// The residual reduction the linear solver is configured with.
+        double tolerance() const { return prm_.get<double>("tol", parameters_.linear_solver_reduction_); }
+
         /// \copydoc NewtonIterationBlackoilInterface::parallelInformation
         const std::any& parallelInformation() const { return parallelInformation_; }
 
@@ -358,7 +384,13 @@ namespace Opm
 
             std::function<Vector()> weightsCalculator = getWeightsCalculator();
 
-            if (shouldCreateSolver()) {
+            const bool precisionChanged = singlePrecisionRequested_ != singlePrecision_;
+            if (precisionChanged) {
+                singlePrecision_ = singlePrecisionRequested_;
+                setMixedPrecision(singlePrecision_);
+            }
+
+            if (precisionChanged || shouldCreateSolver()) {
                 if (isParallel()) {
 #if HAVE_MPI
                     if (useWellConn_) {
@@ -419,13 +451,44 @@ namespace Opm
                 return this->iterations() > 10;
             }
 
-            // Otherwise, do not recreate solver.
-            assert(this->parameters_.cpr_reuse_setup_ == 3);
+            // Otherwise, do not recreate solver. With setting 4 the CPR
+            // preconditioner update is restricted to its numerical values.
+            assert(this->parameters_.cpr_reuse_setup_ == 3 || this->parameters_.cpr_reuse_setup_ == 4);
 
             return false;
         }
 
 
+        /// Switch the preconditioner(s) in the property tree between single
+        /// and double precision storage. For CPR both the fine smoother
+        /// and the coarse level preconditioner are switched.
+        void setMixedPrecision(bool singlePrecision)
+        {
+            prm_.put("preconditioner.mixed_precision", singlePrecision);
+            const auto type = prm_.get<std::string>("preconditioner.type", "cpr");
+            if (type == "cpr" || type == "cprt") {
+                prm_.put("preconditioner.finesmoother.mixed_precision", singlePrecision);
+                prm_.put("preconditioner.coarsesolver.preconditioner.mixed_precision", singlePrecision);
+            }
+        }
+
+        /// Write the linear system, the separate well contributions (if not
+        /// part of the matrix) and quasi-IMPES weights in binary format.
+        void writeBinarySystem() const
+        {
+            std::unique_ptr<SparseMatrixAdapter> wells;
+            if (!useWellConn_) {
+                wells = simulator_.problem().wellModel().wellContributionMatrix(getMatrix().N());
+            }
+            const Vector weights = Amg::getQuasiImpesWeights<Matrix, Vector>(getMatrix(), pressureIndex, false);
+            Helper::writeBinarySystem(simulator_,
+                                      getMatrix(),
+                                      *rhs_,
+                                      wells ? &wells->istlMatrix() : nullptr,
+                                      &weights,
+                                      comm_.get());
+        }
+
         /// Return an appropriate weight function if a cpr preconditioner is asked for.
         std::function<Vector()> getWeightsCalculator() const
         {
@@ -525,6 +588,9 @@ namespace Opm
 
         bool useWellConn_;
         size_t interiorCellNum_;
+        bool singlePrecisionRequested_ = false;
+        bool singlePrecision_ = false;
+        double forcingTerm_ = 0.0;
 
         FlowLinearSolverParameters parameters_;
         PropertyTree prm_;
@@ -204,7 +204,11 @@ public:
 
     bool solve(VectorType& x)
     {
-        solver_->apply(x, rhs_, res_);
+        if (forcingTerm_ > tolerance()) {
+            solver_->apply(x, rhs_, forcingTerm_, res_);
+        } else {
+            solver_->apply(x, rhs_, res_);
+        }
         this->writeMatrix();
         return res_.converged;
     }
@@ -223,6 +227,26 @@ public:
         return res_.iterations;
     }
 
+    // Mixed precision preconditioning is not supported by this solver.
+    void setSinglePrecision(bool /* singlePrecision */)
+    {
+    }
+
+    bool singlePrecision() const
+    {
+        return false;
+    }
+
+    void setForcingTerm(double forcingTerm)
+    {
+        forcingTerm_ = forcingTerm;
+    }
+
+    double tolerance() const
+    {
+        return prm_.get<double>("tol", parameters_.linear_solver_reduction_);
+    }
+
     void setResidual(VectorType& /* b */)
     {
         // rhs_ = &b; // Must be handled in prepare() instead.
@@ -258,7 +282,7 @@ protected:
                 recreate_solver = true;
             }
         } else {
-            assert(this->parameters_.cpr_reuse_setup_ == 3);
+            assert(this->parameters_.cpr_reuse_setup_ == 3 || this->parameters_.cpr_reuse_setup_ == 4);
             assert(recreate_solver == false);
             // Never recreate solver.
         }
@@ -347,6 +371,7 @@ protected:
     PropertyTree prm_;
     VectorType rhs_;
     Dune::InverseOperatorResult res_;
+    double forcingTerm_ = 0.0;
     std::any parallelInformation_;
     bool ownersFirst_;
     bool matrixAddWellContributions_;
@@ -0,0 +1,176 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MIXEDPRECISIONPRECONDITIONER_HEADER_INCLUDED
+#define OPM_MIXEDPRECISIONPRECONDITIONER_HEADER_INCLUDED
+
+#include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <functional>
+#include <memory>
+
+namespace Dune
+{
+
+namespace Detail
+{
+    /// Maps a (double) matrix or vector block type to the same block type
+    /// with float entries.
+    template <class Block>
+    struct SinglePrecisionBlock;
+
+    template <template <class, int, int> class Block, class K, int n, int m>
+    struct SinglePrecisionBlock<Block<K, n, m>>
+    {
+        using type = Block<float, n, m>;
+    };
+
+    template <class K, int n>
+    struct SinglePrecisionBlock<FieldVector<K, n>>
+    {
+        using type = FieldVector<float, n>;
+    };
+} // namespace Detail
+
+/// The matrix type with the same block structure as Matrix, but float entries.
+template <class Matrix>
+using SinglePrecisionMatrix = BCRSMatrix<typename Detail::SinglePrecisionBlock<typename Matrix::block_type>::type>;
+
+/// The vector type with the same block structure as Vector, but float entries.
+template <class Vector>
+using SinglePrecisionVector = BlockVector<typename Detail::SinglePrecisionBlock<typename Vector::block_type>::type>;
+
+
+/// Preconditioner that stores a copy of the matrix and the wrapped
+/// preconditioner (factors, AMG hierarchy) in single precision, while
+/// the outer Krylov iteration stays in double precision. Applying the
+/// preconditioner converts the defect to float and the correction back
+/// to double, which roughly halves the memory traffic of the apply.
+///
+/// \tparam Matrix        The double precision matrix type.
+/// \tparam Vector        The double precision vector type.
+/// \tparam FloatOperator The single precision operator the wrapped
+///                       preconditioner is built from.
+template <class Matrix, class Vector, class FloatOperator>
+class MixedPrecisionPreconditioner : public PreconditionerWithUpdate<Vector, Vector>
+{
+public:
+    using FloatMatrix = typename FloatOperator::matrix_type;
+    using FloatVector = typename FloatOperator::domain_type;
+    using FloatPreconditioner = PreconditionerWithUpdate<FloatVector, FloatVector>;
+    using Creator = std::function<std::shared_ptr<FloatPreconditioner>(const FloatOperator&)>;
+
+    /// \param A             The double precision matrix, which must outlive this object.
+    /// \param creator       Creates the wrapped preconditioner for the single precision operator.
+    /// \param operatorArgs  Further arguments (e.g. the communication) for the
+    ///                      constructor of FloatOperator.
+    template <class... OperatorArgs>
+    MixedPrecisionPreconditioner(const Matrix& A, const Creator& creator, const OperatorArgs&... operatorArgs)
+        : A_(A)
+        , floatOp_(floatA_, operatorArgs...)
+    {
+        copyPattern();
+        copyValues();
+        prec_ = creator(floatOp_);
+    }
+
+    virtual void pre(Vector&, Vector&) override
+    {
+    }
+
+    virtual void apply(Vector& v, const Vector& d) override
+    {
+        floatD_.resize(d.size());
+        floatV_.resize(v.size());
+        for (std::size_t i = 0; i < d.size(); ++i) {
+            for (std::size_t k = 0; k < d[i].size(); ++k) {
+                floatD_[i][k] = d[i][k];
+            }
+        }
+        floatV_ = 0.0f;
+        prec_->apply(floatV_, floatD_);
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            for (std::size_t k = 0; k < v[i].size(); ++k) {
+                v[i][k] = floatV_[i][k];
+            }
+        }
+    }
+
+    virtual void post(Vector&) override
+    {
+    }
+
+    virtual SolverCategory::Category category() const override
+    {
+        return prec_->category();
+    }
+
+    /// Copy the (changed) values of the double precision matrix and
+    /// update the wrapped preconditioner. The sparsity pattern must not change.
+    virtual void update() override
+    {
+        copyValues();
+        prec_->update();
+    }
+
+private:
+    void copyPattern()
+    {
+        floatA_.setSize(A_.N(), A_.M(), A_.nonzeroes());
+        floatA_.setBuildMode(FloatMatrix::row_wise);
+        auto row = A_.begin();
+        for (auto floatRow = floatA_.createbegin(); floatRow != floatA_.createend(); ++floatRow, ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                floatRow.insert(col.index());
+            }
+        }
+    }
+
+    void copyValues()
+    {
+        // Both matrices have the same pattern, hence the entries can be
+        // traversed in lockstep.
+        auto floatRow = floatA_.begin();
+        for (auto row = A_.begin(); row != A_.end(); ++row, ++floatRow) {
+            auto floatCol = floatRow->begin();
+            for (auto col = row->begin(); col != row->end(); ++col, ++floatCol) {
+                for (std::size_t i = 0; i < col->N(); ++i) {
+                    for (std::size_t j = 0; j < col->M(); ++j) {
+                        (*floatCol)[i][j] = (*col)[i][j];
+                    }
+                }
+            }
+        }
+    }
+
+    const Matrix& A_;
+    FloatMatrix floatA_;
+    FloatOperator floatOp_;
+    std::shared_ptr<FloatPreconditioner> prec_;
+    FloatVector floatD_;
+    FloatVector floatV_;
+};
+
+} // namespace Dune
+
+#endif // OPM_MIXEDPRECISIONPRECONDITIONER_HEADER_INCLUDED
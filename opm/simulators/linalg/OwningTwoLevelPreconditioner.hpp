@@ -103,6 +103,7 @@ public:
                            prm.get<int>("pre_smooth", transpose? 1 : 0),
                            prm.get<int>("post_smooth", transpose? 0 : 1))
         , prm_(prm)
+        , numericUpdateOnly_(prm.get<bool>("update_numeric_only", false))
     {
         if (prm.get<int>("verbosity", 0) > 10) {
             std::string filename = prm.get<std::string>("weights_filename", "impes_weights.txt");
@@ -135,6 +136,7 @@ public:
                            prm.get<int>("pre_smooth", transpose? 1 : 0),
                            prm.get<int>("post_smooth", transpose? 0 : 1))
         , prm_(prm)
+        , numericUpdateOnly_(prm.get<bool>("update_numeric_only", false))
     {
         if (prm.get<int>("verbosity", 0) > 10 && comm.communicator().rank() == 0) {
             auto filename = prm.get<std::string>("weights_filename", "impes_weights.txt");
@@ -192,6 +194,10 @@ private:
     template <class Comm>
     void updateImpl(const Comm*)
     {
+        if (numericUpdateOnly_) {
+            updateNumericOnly();
+            return;
+        }
         // Parallel case.
         auto child = prm_.get_child_optional("finesmoother");
         finesmoother_ = PrecFactory::create(linear_operator_, child ? *child : Opm::PropertyTree(), *comm_);
@@ -200,14 +206,27 @@ private:
 
     void updateImpl(const Dune::Amg::SequentialInformation*)
     {
+        if (numericUpdateOnly_) {
+            updateNumericOnly();
+            return;
+        }
         // Serial case.
         auto child = prm_.get_child_optional("finesmoother");
         finesmoother_ = PrecFactory::create(linear_operator_, child ? *child : Opm::PropertyTree());
         twolevel_method_.updatePreconditioner(finesmoother_, coarseSolverPolicy_);
     }
 
+    // Keep the fine smoother setup (ordering, ILU sparsity pattern) and the
+    // coarse level sparsity and aggregates, and only recompute the values.
+    // Assumes the sparsity pattern of the fine level matrix is unchanged.
+    void updateNumericOnly()
+    {
+        finesmoother_->update();
+        twolevel_method_.updateCoarseValues();
+    }
+
     const OperatorType& linear_operator_;
-    std::shared_ptr<Dune::Preconditioner<VectorType, VectorType>> finesmoother_;
+    std::shared_ptr<Dune::PreconditionerWithUpdate<VectorType, VectorType>> finesmoother_;
     const Communication* comm_;
     std::function<VectorType()> weightsCalculator_;
     VectorType weights_;
@@ -215,6 +234,7 @@ private:
     CoarseSolverPolicy coarseSolverPolicy_;
     TwoLevelMethod twolevel_method_;
     Opm::PropertyTree prm_;
+    bool numericUpdateOnly_;
     Communication dummy_comm_;
 };
 
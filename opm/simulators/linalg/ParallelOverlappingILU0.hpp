@@ -22,6 +22,7 @@
 
 #include <opm/simulators/linalg/GraphColoring.hpp>
 #include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+#include <opm/simulators/linalg/bda/Reorder.hpp>
 #include <opm/common/ErrorMacros.hpp>
 #include <dune/common/version.hh>
 #include <dune/istl/preconditioner.hh>
@@ -29,11 +30,13 @@
 #include <dune/istl/paamg/graph.hh>
 #include <dune/istl/paamg/pinfo.hh>
 
+#include <algorithm>
 #include <type_traits>
 #include <numeric>
 #include <limits>
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace Opm
 {
@@ -493,6 +496,159 @@ namespace Opm
         }
     }
 
+    //! \brief Compute a level scheduling for the interior rows of A.
+    //!
+    //! Rows within one level do not couple to each other. As the pattern
+    //! is symmetrized this holds for both the lower and the upper triangular
+    //! part, hence all rows of a level can be eliminated and solved for
+    //! concurrently. The ghost rows (index >= interiorSize) keep their
+    //! position at the end.
+    //! \param A The matrix.
+    //! \param interiorSize The number of interior rows to reorder.
+    //! \param[out] ordering ordering[i] is the new index of row i.
+    //! \param[out] levelStart The rows of level l are
+    //!                        [levelStart[l], levelStart[l+1]) after reordering.
+    template<class M>
+    void findLevelSchedulingOrdering(const M& A, std::size_t interiorSize,
+                                     std::vector<std::size_t>& ordering,
+                                     std::vector<std::size_t>& levelStart)
+    {
+        ordering.resize(A.N());
+        std::iota(ordering.begin(), ordering.end(), 0);
+        levelStart.clear();
+        if (interiorSize == 0)
+            return;
+
+        // Symmetrized off-diagonal pattern of the interior rows in CSR format.
+        const int numRows = interiorSize;
+        std::vector<int> rowPointers(numRows + 1, 0);
+        for (auto row = A.begin(); row.index() < interiorSize; ++row)
+            for (auto col = row->begin(); col != row->end(); ++col)
+                if (col.index() < interiorSize && col.index() != row.index()) {
+                    ++rowPointers[row.index() + 1];
+                    ++rowPointers[col.index() + 1];
+                }
+        std::partial_sum(rowPointers.begin(), rowPointers.end(), rowPointers.begin());
+
+        std::vector<int> colIndices(rowPointers[numRows]);
+        std::vector<int> position(rowPointers.begin(), rowPointers.end() - 1);
+        for (auto row = A.begin(); row.index() < interiorSize; ++row)
+            for (auto col = row->begin(); col != row->end(); ++col)
+                if (col.index() < interiorSize && col.index() != row.index()) {
+                    colIndices[position[row.index()]++] = col.index();
+                    colIndices[position[col.index()]++] = row.index();
+                }
+
+        // Sort the rows and remove duplicates, compacting in place.
+        int nnz = 0;
+        for (int row = 0; row < numRows; ++row) {
+            const auto rowBegin = colIndices.begin() + rowPointers[row];
+            const auto rowEnd = colIndices.begin() + rowPointers[row + 1];
+            std::sort(rowBegin, rowEnd);
+            const auto uniqueEnd = std::unique(rowBegin, rowEnd);
+            rowPointers[row] = nnz;
+            nnz = std::copy(rowBegin, uniqueEnd, colIndices.begin() + nnz) - colIndices.begin();
+        }
+        rowPointers[numRows] = nnz;
+
+        // The pattern is symmetric, hence it is its own CSC representation.
+        std::vector<int> toOrder(numRows);
+        std::vector<int> fromOrder(numRows);
+        std::vector<int> rowsPerColor;
+        int numColors = 0;
+        bda::findLevelScheduling(colIndices.data(), rowPointers.data(),
+                                 colIndices.data(), rowPointers.data(),
+                                 numRows, &numColors, toOrder.data(),
+                                 fromOrder.data(), rowsPerColor);
+
+        std::copy(toOrder.begin(), toOrder.end(), ordering.begin());
+        levelStart.resize(numColors + 1, 0);
+        std::partial_sum(rowsPerColor.begin(), rowsPerColor.end(), levelStart.begin() + 1);
+    }
+
+    //! \brief Compute Blocked ILU0 decomposition of a level scheduled matrix.
+    //!
+    //! The rows of each level are eliminated in parallel using OpenMP. Each
+    //! row only reads rows of previous levels, which are already factorized.
+    //! Ghost rows beyond the last level are not touched.
+    template<class M>
+    void level_scheduled_bilu0_decomposition (M& A, const std::vector<std::size_t>& levelStart)
+    {
+        typedef typename M::ColIterator coliterator;
+        typedef typename M::block_type block;
+        typedef typename M::size_type size_type;
+
+        for (std::size_t level = 0; level + 1 < levelStart.size(); ++level)
+        {
+            const std::ptrdiff_t levelBegin = levelStart[level];
+            const std::ptrdiff_t levelEnd = levelStart[level + 1];
+            // Exceptions must not escape an OpenMP region, record the failing row instead.
+            std::ptrdiff_t missingDiagonal = -1;
+            std::ptrdiff_t singularDiagonal = -1;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (std::ptrdiff_t rowIdx = levelBegin; rowIdx < levelEnd; ++rowIdx)
+            {
+                const size_type i = rowIdx;
+                auto& row = A[i];
+                coliterator endij = row.end();
+                coliterator ij;
+
+                // eliminate entries left of diagonal; store L factor
+                for (ij = row.begin(); ij.index() < i; ++ij)
+                {
+                    coliterator jj = A[ij.index()].find(ij.index());
+                    (*ij).rightmultiply(*jj);
+
+                    coliterator endjk = A[ij.index()].end();
+                    coliterator jk = jj; ++jk;
+                    coliterator ik = ij; ++ik;
+                    while (ik != endij && jk != endjk)
+                        if (ik.index() == jk.index())
+                        {
+                            block B(*jk);
+                            B.leftmultiply(*ij);
+                            *ik -= B;
+                            ++ik; ++jk;
+                        }
+                        else
+                        {
+                            if (ik.index() < jk.index())
+                                ++ik;
+                            else
+                                ++jk;
+                        }
+                }
+
+                if (ij.index() != i)
+                {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                    missingDiagonal = rowIdx;
+                    continue;
+                }
+                try {
+                    (*ij).invert();
+                }
+                catch (Dune::FMatrixError&) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                    singularDiagonal = rowIdx;
+                }
+            }
+
+            if (missingDiagonal >= 0)
+                DUNE_THROW(Dune::ISTLError, "diagonal entry missing in row " << missingDiagonal);
+            if (singularDiagonal >= 0)
+                DUNE_THROW(Dune::MatrixBlockError, "ILU failed to invert matrix block A["
+                           << singularDiagonal << "][" << singularDiagonal << "]");
+        }
+    }
+
       //! compute ILU decomposition of A. A is overwritten by its decomposition
       template<class M, class CRS, class InvVector>
       void convertToCRS(const M& A, CRS& lower, CRS& upper, InvVector& inv )
@@ -692,19 +848,24 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling If true, the interior rows are reordered into levels
+                              of mutually independent rows that are factorized
+                              and solved for in parallel using OpenMP threads.
+                              Only used for ILU0.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool level_scheduling=false)
         : lower_(),
           upper_(),
           inv_(),
           comm_(nullptr), w_(w),
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+          levelScheduling_(level_scheduling)
     {
         interiorSize_ = A.N();
         // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -723,19 +884,24 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling If true, the interior rows are reordered into levels
+                              of mutually independent rows that are factorized
+                              and solved for in parallel using OpenMP threads.
+                              Only used for ILU0.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const ParallelInfo& comm, const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool level_scheduling=false)
         : lower_(),
           upper_(),
           inv_(),
           comm_(&comm), w_(w),
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+          levelScheduling_(level_scheduling)
     {
         interiorSize_ = A.N();
         // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -754,12 +920,16 @@ public:
                   The vertices on each layer aound it (same distance) are
                   ordered consecutivly. If false, we preserver the order of
                   the vertices with the same color.
+      \param level_scheduling If true, the interior rows are reordered into levels
+                              of mutually independent rows that are factorized
+                              and solved for in parallel using OpenMP threads.
+                              Only used for ILU0.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const field_type w, MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
-        : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere )
+                             bool reorder_sphere=true, bool level_scheduling=false)
+        : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere, level_scheduling )
     {
     }
 
@@ -775,19 +945,24 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling If true, the interior rows are reordered into levels
+                              of mutually independent rows that are factorized
+                              and solved for in parallel using OpenMP threads.
+                              Only used for ILU0.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const ParallelInfo& comm, const field_type w,
                              MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool level_scheduling=false)
         : lower_(),
           upper_(),
           inv_(),
           comm_(&comm), w_(w),
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+          levelScheduling_(level_scheduling)
     {
         interiorSize_ = A.N();
         // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -808,13 +983,17 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling If true, the interior rows are reordered into levels
+                              of mutually independent rows that are factorized
+                              and solved for in parallel using OpenMP threads.
+                              Only used for ILU0.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const ParallelInfo& comm,
                              const field_type w, MILU_VARIANT milu,
                              size_type interiorSize, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool level_scheduling=false)
         : lower_(),
           upper_(),
           inv_(),
@@ -822,7 +1001,8 @@ public:
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           interiorSize_(interiorSize),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+          levelScheduling_(level_scheduling)
     {
         // BlockMatrix is a Subclass of FieldMatrix that just adds
         // methods. Therefore this cast should be safe.
@@ -863,8 +1043,7 @@ public:
             OPM_THROW(std::logic_error,"ILU: number of lower and upper rows must be the same");
         }
 
-        // lower triangular solve
-        for( size_type i=0; i<lowerLoopEnd; ++ i )
+        auto lowerSolve = [&]( const size_type i )
         {
           dblock rhs( md[ i ] );
           const size_type rowI     = lower_.rows_[ i ];
@@ -876,9 +1055,9 @@ public:
           }
 
           mv[ i ] = rhs;  // Lii = I
-        }
+        };
 
-        for( size_type i=upperLoppStart; i<iEnd; ++ i )
+        auto upperSolve = [&]( const size_type i )
         {
             vblock& vBlock = mv[ lastRow - i ];
             vblock rhs ( vBlock );
@@ -892,6 +1071,53 @@ public:
 
             // apply inverse and store result
             inv_[ i ].mv( rhs, vBlock);
+        };
+
+        if ( levelStart_.empty() )
+        {
+            // lower triangular solve
+            for( size_type i=0; i<lowerLoopEnd; ++ i )
+            {
+                lowerSolve( i );
+            }
+
+            for( size_type i=upperLoppStart; i<iEnd; ++ i )
+            {
+                upperSolve( i );
+            }
+        }
+        else
+        {
+            // The levels cover exactly the interior rows. Rows of a level
+            // are independent of each other in both triangular factors.
+            const std::size_t numLevels = levelStart_.size() - 1;
+            for( std::size_t level = 0; level < numLevels; ++level )
+            {
+                const std::ptrdiff_t levelBegin = levelStart_[ level ];
+                const std::ptrdiff_t levelEnd = levelStart_[ level+1 ];
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for( std::ptrdiff_t i = levelBegin; i < levelEnd; ++i )
+                {
+                    lowerSolve( i );
+                }
+            }
+
+            // upper_ stores the rows in reverse order, i.e. the matrix rows
+            // [levelBegin, levelEnd) are [lastRow-levelEnd+1, lastRow-levelBegin] there.
+            for( std::size_t level = numLevels; level-- > 0; )
+            {
+                const std::ptrdiff_t upperBegin = lastRow + 1 - levelStart_[ level+1 ];
+                const std::ptrdiff_t upperEnd = lastRow + 1 - levelStart_[ level ];
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for( std::ptrdiff_t i = upperBegin; i < upperEnd; ++i )
+                {
+                    upperSolve( i );
+                }
+            }
         }
 
         copyOwnerToAll( mv );
@@ -963,6 +1189,13 @@ public:
                                                       graph);
             }
         }
+        else if ( levelScheduling_ && iluIteration_ == 0 && ordering_.size() != A_->N() )
+        {
+            // Fill-in of ILU-n would couple rows within a level, hence
+            // level scheduling is only used for ILU0. The sparsity pattern
+            // does not change between updates, so the levels are computed once.
+            detail::findLevelSchedulingOrdering( *A_, interiorSize_, ordering_, levelStart_ );
+        }
 
         std::vector<std::size_t> inverseOrdering(ordering_.size());
         std::size_t index = 0;
@@ -1021,7 +1254,9 @@ public:
                                                   detail::IsPositiveFunctor() );
                     break;
                 default:
-                    if (interiorSize_ == A_->N())
+                    if (!levelStart_.empty())
+                        detail::level_scheduled_bilu0_decomposition(*ILU, levelStart_);
+                    else if (interiorSize_ == A_->N())
                         bilu0_decomposition( *ILU );
                     else
                         detail::ghost_last_bilu0_decomposition(*ILU, interiorSize_);
@@ -1143,6 +1378,10 @@ protected:
     MILU_VARIANT milu_;
     bool redBlack_;
     bool reorderSphere_;
+    //! \brief Whether to reorder into levels that are processed by OpenMP threads.
+    bool levelScheduling_;
+    //! \brief The rows of level l are [levelStart_[l], levelStart_[l+1]) (reordered).
+    std::vector< std::size_t > levelStart_;
 };
 
 } // end namespace Opm
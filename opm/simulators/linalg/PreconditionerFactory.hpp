@@ -22,6 +22,7 @@
 #ifndef OPM_PRECONDITIONERFACTORY_HEADER
 #define OPM_PRECONDITIONERFACTORY_HEADER
 
+#include <opm/simulators/linalg/MixedPrecisionPreconditioner.hpp>
 #include <opm/simulators/linalg/OwningBlockPreconditioner.hpp>
 #include <opm/simulators/linalg/OwningTwoLevelPreconditioner.hpp>
 #include <opm/simulators/linalg/ParallelOverlappingILU0.hpp>
@@ -123,14 +124,17 @@ public:
     }
 
 private:
+    template <class M>
     using CriterionBase
-        = Dune::Amg::AggregationCriterion<Dune::Amg::SymmetricDependency<Matrix, Dune::Amg::FirstDiagonal>>;
-    using Criterion = Dune::Amg::CoarsenCriterion<CriterionBase>;
+        = Dune::Amg::AggregationCriterion<Dune::Amg::SymmetricDependency<M, Dune::Amg::FirstDiagonal>>;
+    template <class M = Matrix>
+    using Criterion = Dune::Amg::CoarsenCriterion<CriterionBase<M>>;
 
     // Helpers for creation of AMG preconditioner.
-    static Criterion amgCriterion(const PropertyTree& prm)
+    template <class M = Matrix>
+    static Criterion<M> amgCriterion(const PropertyTree& prm)
     {
-        Criterion criterion(15, prm.get<int>("coarsenTarget", 1200));
+        Criterion<M> criterion(15, prm.get<int>("coarsenTarget", 1200));
         criterion.setDefaultValuesIsotropic(2);
         criterion.setAlpha(prm.get<double>("alpha", 0.33));
         criterion.setBeta(prm.get<double>("beta", 1e-5));
@@ -235,22 +239,109 @@ private:
     }
 
     static PrecPtr
-    createParILU(const Operator& op, const PropertyTree& prm, const Comm& comm, const int ilulevel)
+    createParILU(const Operator& op, const PropertyTree& prm, const Comm& comm, const int ilulevel,
+                 const bool threaded = false)
     {
         const double w = prm.get<double>("relaxation", 1.0);
         const bool redblack = prm.get<bool>("redblack", false);
         const bool reorder_spheres = prm.get<bool>("reorder_spheres", false);
+        const bool level_scheduling = threaded || prm.get<bool>("level_scheduling", false);
         // Already a parallel preconditioner. Need to pass comm, but no need to wrap it in a BlockPreconditioner.
         if (ilulevel == 0) {
             const size_t num_interior = interiorIfGhostLast(comm);
             return std::make_shared<Opm::ParallelOverlappingILU0<Matrix, Vector, Vector, Comm>>(
-                op.getmat(), comm, w, Opm::MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres);
+                op.getmat(), comm, w, Opm::MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres,
+                level_scheduling);
         } else {
             return std::make_shared<Opm::ParallelOverlappingILU0<Matrix, Vector, Vector, Comm>>(
                 op.getmat(), comm, ilulevel, w, Opm::MILU_VARIANT::ILU, redblack, reorder_spheres);
         }
     }
 
+    /// Create a preconditioner that keeps its matrices and factors in single
+    /// precision, if prm requests "mixed_precision" and the type supports it.
+    /// Supported are the ILU variants and plain AMG with an ILU0 smoother.
+    /// Returns nullptr otherwise, in which case the double precision version is used.
+    static PrecPtr createMixedPrecision(const Operator& op, const PropertyTree& prm)
+    {
+        if constexpr (std::is_same_v<typename Matrix::field_type, double>) {
+            using FM = Dune::SinglePrecisionMatrix<Matrix>;
+            using FV = Dune::SinglePrecisionVector<Vector>;
+            using FloatOperator = Dune::MatrixAdapter<FM, FV, FV>;
+            using MixedPrecision = Dune::MixedPrecisionPreconditioner<Matrix, Vector, FloatOperator>;
+
+            const std::string type = prm.get<std::string>("type", "ParOverILU0");
+            if (type == "ILU0" || type == "ParOverILU0" || type == "ILUn" || type == "ThreadedILU0") {
+                const double w = prm.get<double>("relaxation", 1.0);
+                const int n = (type == "ILU0" || type == "ThreadedILU0") ? 0 : prm.get<int>("ilulevel", 0);
+                const bool level_scheduling = type == "ThreadedILU0" || prm.get<bool>("level_scheduling", false);
+                return std::make_shared<MixedPrecision>(op.getmat(), [=](const FloatOperator& fop) {
+                    return std::make_shared<Opm::ParallelOverlappingILU0<FM, FV, FV>>(
+                        fop.getmat(), n, w, Opm::MILU_VARIANT::ILU, false, true, level_scheduling);
+                });
+            }
+            if constexpr (std::is_same_v<Operator, Dune::MatrixAdapter<Matrix, Vector, Vector>>) {
+                const std::string smoother = prm.get<std::string>("smoother", "ParOverILU0");
+                if (type == "amg" && (smoother == "ILU0" || smoother == "ParOverILU0")) {
+                    return std::make_shared<MixedPrecision>(op.getmat(), [prm](const FloatOperator& fop) {
+#if DUNE_VERSION_NEWER(DUNE_ISTL, 2, 7)
+                        using Smoother = Dune::SeqILU<FM, FV, FV>;
+#else
+                        using Smoother = Dune::SeqILU0<FM, FV, FV>;
+#endif
+                        auto crit = amgCriterion<FM>(prm);
+                        auto sargs = amgSmootherArgs<Smoother>(prm);
+                        return std::make_shared<Dune::Amg::AMGCPR<FloatOperator, FV, Smoother>>(fop, crit, sargs);
+                    });
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    /// Parallel version of createMixedPrecision().
+    static PrecPtr createMixedPrecision(const Operator& op, const PropertyTree& prm, const Comm& comm)
+    {
+        if constexpr (std::is_same_v<typename Matrix::field_type, double>) {
+            using FM = Dune::SinglePrecisionMatrix<Matrix>;
+            using FV = Dune::SinglePrecisionVector<Vector>;
+            using FloatOperator = Dune::OverlappingSchwarzOperator<FM, FV, FV, Comm>;
+            using MixedPrecision = Dune::MixedPrecisionPreconditioner<Matrix, Vector, FloatOperator>;
+
+            const std::string type = prm.get<std::string>("type", "ParOverILU0");
+            if (type == "ILU0" || type == "ParOverILU0" || type == "ILUn" || type == "ThreadedILU0") {
+                const double w = prm.get<double>("relaxation", 1.0);
+                const int n = (type == "ILU0" || type == "ThreadedILU0") ? 0 : prm.get<int>("ilulevel", 0);
+                const bool redblack = prm.get<bool>("redblack", false);
+                const bool reorder_spheres = prm.get<bool>("reorder_spheres", false);
+                const bool level_scheduling = type == "ThreadedILU0" || prm.get<bool>("level_scheduling", false);
+                const size_t num_interior = interiorIfGhostLast(comm);
+                return std::make_shared<MixedPrecision>(op.getmat(), [=, &comm](const FloatOperator& fop)
+                    -> std::shared_ptr<Dune::PreconditionerWithUpdate<FV, FV>> {
+                    using ILU = Opm::ParallelOverlappingILU0<FM, FV, FV, Comm>;
+                    if (n == 0) {
+                        return std::make_shared<ILU>(fop.getmat(), comm, w, Opm::MILU_VARIANT::ILU,
+                                                     num_interior, redblack, reorder_spheres, level_scheduling);
+                    }
+                    return std::make_shared<ILU>(fop.getmat(), comm, n, w, Opm::MILU_VARIANT::ILU,
+                                                 redblack, reorder_spheres);
+                }, comm);
+            }
+            if constexpr (std::is_same_v<Operator, Dune::OverlappingSchwarzOperator<Matrix, Vector, Vector, Comm>>) {
+                const std::string smoother = prm.get<std::string>("smoother", "ParOverILU0");
+                if (type == "amg" && (smoother == "ILU0" || smoother == "ParOverILU0")) {
+                    return std::make_shared<MixedPrecision>(op.getmat(), [prm, &comm](const FloatOperator& fop) {
+                        using Smoother = Opm::ParallelOverlappingILU0<FM, FV, FV, Comm>;
+                        auto crit = amgCriterion<FM>(prm);
+                        auto sargs = amgSmootherArgs<Smoother>(prm);
+                        return std::make_shared<Dune::Amg::AMGCPR<FloatOperator, FV, Smoother, Comm>>(fop, crit, sargs, comm);
+                    }, comm);
+                }
+            }
+        }
+        return nullptr;
+    }
+
     // Add a useful default set of preconditioners to the factory.
     // This is the default template, used for parallel preconditioners.
     // (Serial specialization below).
@@ -272,6 +363,9 @@ private:
         doAddCreator("ILUn", [](const O& op, const P& prm, const std::function<Vector()>&, std::size_t, const C& comm) {
             return createParILU(op, prm, comm, prm.get<int>("ilulevel", 0));
         });
+        doAddCreator("ThreadedILU0", [](const O& op, const P& prm, const std::function<Vector()>&, std::size_t, const C& comm) {
+            return createParILU(op, prm, comm, 0, true);
+        });
         doAddCreator("Jac", [](const O& op, const P& prm, const std::function<Vector()>&,
                                std::size_t, const C& comm) {
             const int n = prm.get<int>("repeats", 1);
@@ -341,14 +435,16 @@ private:
         using P = PropertyTree;
         doAddCreator("ILU0", [](const O& op, const P& prm, const std::function<Vector()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
+            const bool level_scheduling = prm.get<bool>("level_scheduling", false);
             return std::make_shared<Opm::ParallelOverlappingILU0<M, V, V>>(
-                op.getmat(), 0, w, Opm::MILU_VARIANT::ILU);
+                op.getmat(), 0, w, Opm::MILU_VARIANT::ILU, false, true, level_scheduling);
         });
         doAddCreator("ParOverILU0", [](const O& op, const P& prm, const std::function<Vector()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
             const int n = prm.get<int>("ilulevel", 0);
+            const bool level_scheduling = prm.get<bool>("level_scheduling", false);
             return std::make_shared<Opm::ParallelOverlappingILU0<M, V, V>>(
-                op.getmat(), n, w, Opm::MILU_VARIANT::ILU);
+                op.getmat(), n, w, Opm::MILU_VARIANT::ILU, false, true, level_scheduling);
         });
         doAddCreator("ILUn", [](const O& op, const P& prm, const std::function<Vector()>&, std::size_t) {
             const int n = prm.get<int>("ilulevel", 0);
@@ -356,6 +452,11 @@ private:
             return std::make_shared<Opm::ParallelOverlappingILU0<M, V, V>>(
                 op.getmat(), n, w, Opm::MILU_VARIANT::ILU);
         });
+        doAddCreator("ThreadedILU0", [](const O& op, const P& prm, const std::function<Vector()>&, std::size_t) {
+            const double w = prm.get<double>("relaxation", 1.0);
+            return std::make_shared<Opm::ParallelOverlappingILU0<M, V, V>>(
+                op.getmat(), 0, w, Opm::MILU_VARIANT::ILU, false, true, true);
+        });
         doAddCreator("Jac", [](const O& op, const P& prm, const std::function<Vector()>&, std::size_t) {
             const int n = prm.get<int>("repeats", 1);
             const double w = prm.get<double>("relaxation", 1.0);
@@ -486,6 +587,11 @@ private:
                      const std::function<Vector()> weightsCalculator,
                      std::size_t pressureIndex)
     {
+        if (prm.get<bool>("mixed_precision", false)) {
+            if (auto prec = createMixedPrecision(op, prm)) {
+                return prec;
+            }
+        }
         const std::string& type = prm.get<std::string>("type", "ParOverILU0");
         auto it = creators_.find(type);
         if (it == creators_.end()) {
@@ -504,6 +610,11 @@ private:
                      const std::function<Vector()> weightsCalculator,
                      std::size_t pressureIndex, const Comm& comm)
     {
+        if (prm.get<bool>("mixed_precision", false)) {
+            if (auto prec = createMixedPrecision(op, prm, comm)) {
+                return prec;
+            }
+        }
         const std::string& type = prm.get<std::string>("type", "ParOverILU0");
         auto it = parallel_creators_.find(type);
         if (it == parallel_creators_.end()) {
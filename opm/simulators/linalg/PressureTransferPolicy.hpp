@@ -76,7 +76,8 @@ public:
     virtual void calculateCoarseEntries(const FineOperator& fineOperator) override
     {
         const auto& fineMatrix = fineOperator.getmat();
-        *coarseLevelMatrix_ = 0;
+        // The coarse matrix has the sparsity pattern of the fine matrix,
+        // so every entry is overwritten below and need not be zeroed first.
         auto rowCoarse = coarseLevelMatrix_->begin();
         for (auto row = fineMatrix.begin(), rowEnd = fineMatrix.end(); row != rowEnd; ++row, ++rowCoarse) {
             assert(row.index() == rowCoarse.index());
@@ -110,6 +110,7 @@ template bool PropertyTree::get<bool>(const std::string& key, const bool& defVal
 template void PropertyTree::put<std::string>(const std::string& key, const std::string& value);
 template void PropertyTree::put<double>(const std::string& key, const double& value);
 template void PropertyTree::put<int>(const std::string& key, const int& value);
+template void PropertyTree::put<bool>(const std::string& key, const bool& value);
 
 
 } // namespace Opm
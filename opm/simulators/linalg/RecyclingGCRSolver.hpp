@@ -0,0 +1,256 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_RECYCLINGGCRSOLVER_HEADER_INCLUDED
+#define OPM_RECYCLINGGCRSOLVER_HEADER_INCLUDED
+
+#include <dune/common/timer.hh>
+#include <dune/common/version.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioner.hh>
+#include <dune/istl/scalarproducts.hh>
+#include <dune/istl/solver.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace Dune
+{
+
+/// Right preconditioned, restarted GCR solver that recycles a small
+/// subspace between restarts and between calls to apply(), in the
+/// spirit of GCRO-DR.
+///
+/// The solver keeps up to recycleSize search directions U together with
+/// C = A U, with C orthonormal. Each cycle first removes the component
+/// of the residual in span(C), and all new directions are orthogonalized
+/// against C. At the end of a cycle the directions that reduced the
+/// residual the most are kept for the following cycles and solves. When
+/// apply() is called again, C = A U is recomputed, so the operator may
+/// have changed in between (e.g. the next Newton iteration).
+///
+/// Instead of harmonic Ritz vectors (which would need a dense
+/// eigensolver), directions are selected by the size of their
+/// coefficient in the residual reduction.
+template <class X>
+class RecyclingGCRSolver : public InverseOperator<X, X>
+{
+public:
+    using field_type = typename X::field_type;
+
+    RecyclingGCRSolver(LinearOperator<X, X>& op,
+                       ScalarProduct<X>& sp,
+                       Preconditioner<X, X>& prec,
+                       double reduction,
+                       int restart,
+                       int recycleSize,
+                       int maxit,
+                       int verbose)
+        : op_(op)
+        , sp_(sp)
+        , prec_(prec)
+        , reduction_(reduction)
+        , restart_(std::max(restart, 1))
+        , recycleSize_(std::max(recycleSize, 0))
+        , maxit_(maxit)
+        , verbose_(verbose)
+    {
+    }
+
+    virtual void apply(X& x, X& b, InverseOperatorResult& res) override
+    {
+        apply(x, b, reduction_, res);
+    }
+
+    virtual void apply(X& x, X& b, double reduction, InverseOperatorResult& res) override
+    {
+        Timer watch;
+        res.clear();
+
+        // Residual r = b - A x, stored in b.
+        X& r = b;
+        prec_.pre(x, r);
+        op_.applyscaleadd(-1.0, x, r);
+        const double def0 = sp_.norm(r);
+        double def = def0;
+        if (verbose_ > 0) {
+            std::cout << "=== RecyclingGCRSolver (" << U_.size() << " recycled vectors)" << std::endl;
+        }
+
+        refreshRecycledSpace(r);
+
+        int iter = 0;
+        bool converged = !(def0 > 0.0);
+        X z(x);
+        X c(r);
+        while (!converged && iter < maxit_) {
+            // Remove the part of the residual in the recycled space.
+            std::vector<double> weights(U_.size());
+            for (std::size_t i = 0; i < U_.size(); ++i) {
+                const field_type alpha = sp_.dot(C_[i], r);
+                x.axpy(alpha, U_[i]);
+                r.axpy(-alpha, C_[i]);
+                weights[i] = std::abs(alpha);
+            }
+            def = sp_.norm(r);
+            converged = def <= reduction * def0;
+
+            // One GCR cycle, orthogonalizing against recycled and new directions.
+            std::vector<X> cycleU;
+            std::vector<X> cycleC;
+            std::vector<double> cycleWeights;
+            for (int k = 0; k < restart_ && !converged && iter < maxit_; ++k) {
+                ++iter;
+                z = 0.0;
+                prec_.apply(z, r);
+                op_.apply(z, c);
+                orthogonalize(C_, U_, z, c);
+                orthogonalize(cycleC, cycleU, z, c);
+                const double cnorm = sp_.norm(c);
+                if (!(cnorm > 0.0) || !std::isfinite(cnorm)) {
+                    break;
+                }
+                z *= 1.0 / cnorm;
+                c *= 1.0 / cnorm;
+                const field_type alpha = sp_.dot(c, r);
+                x.axpy(alpha, z);
+                r.axpy(-alpha, c);
+                cycleU.push_back(z);
+                cycleC.push_back(c);
+                cycleWeights.push_back(std::abs(alpha));
+
+                def = sp_.norm(r);
+                if (verbose_ > 1) {
+                    std::cout << "   " << iter << "  " << def << std::endl;
+                }
+                converged = def <= reduction * def0;
+            }
+            if (cycleU.empty() && !converged) {
+                // Breakdown, the preconditioned residual lies in span(U).
+                break;
+            }
+            selectRecycledSpace(weights, cycleU, cycleC, cycleWeights);
+        }
+
+        prec_.post(x);
+        res.iterations = iter;
+        res.reduction = def0 > 0.0 ? def / def0 : 0.0;
+        res.conv_rate = iter > 0 ? std::pow(res.reduction, 1.0 / iter) : 0.0;
+        res.converged = converged;
+        res.elapsed = watch.elapsed();
+        if (verbose_ > 0) {
+            std::cout << "=== rate=" << res.conv_rate << ", T=" << res.elapsed
+                      << ", TIT=" << (iter > 0 ? res.elapsed / iter : 0.0)
+                      << ", IT=" << iter << std::endl;
+        }
+    }
+
+#if DUNE_VERSION_NEWER(DUNE_ISTL, 2, 6)
+    virtual SolverCategory::Category category() const override
+    {
+        return op_.category();
+    }
+#endif
+
+private:
+    // Make z, c orthogonal to the (orthonormal) vectors in C, keeping c = A z.
+    void orthogonalize(const std::vector<X>& C, const std::vector<X>& U, X& z, X& c) const
+    {
+        for (std::size_t i = 0; i < C.size(); ++i) {
+            const field_type beta = sp_.dot(C[i], c);
+            c.axpy(-beta, C[i]);
+            z.axpy(-beta, U[i]);
+        }
+    }
+
+    // Recompute C = A U for the current operator and orthonormalize it,
+    // dropping directions that have become (numerically) dependent.
+    void refreshRecycledSpace(const X& r)
+    {
+        std::vector<X> U;
+        std::vector<X> C;
+        X c(r);
+        for (auto& u : U_) {
+            op_.apply(u, c);
+            orthogonalize(C, U, u, c);
+            const double cnorm = sp_.norm(c);
+            if (cnorm > 0.0 && std::isfinite(cnorm)) {
+                u *= 1.0 / cnorm;
+                c *= 1.0 / cnorm;
+                U.push_back(u);
+                C.push_back(c);
+            }
+        }
+        U_ = std::move(U);
+        C_ = std::move(C);
+    }
+
+    // Keep the recycleSize_ directions with the largest residual reduction
+    // among the recycled and the new directions. They are all mutually
+    // orthonormal (in C), so any subset is as well.
+    void selectRecycledSpace(const std::vector<double>& weights,
+                             std::vector<X>& cycleU,
+                             std::vector<X>& cycleC,
+                             const std::vector<double>& cycleWeights)
+    {
+        const std::size_t numOld = U_.size();
+        std::vector<double> all(weights);
+        all.insert(all.end(), cycleWeights.begin(), cycleWeights.end());
+        std::vector<std::size_t> order(all.size());
+        std::iota(order.begin(), order.end(), 0);
+        const std::size_t keep = std::min(order.size(), static_cast<std::size_t>(recycleSize_));
+        std::partial_sort(order.begin(), order.begin() + keep, order.end(),
+                          [&all](std::size_t a, std::size_t b) { return all[a] > all[b]; });
+
+        std::vector<X> U;
+        std::vector<X> C;
+        U.reserve(keep);
+        C.reserve(keep);
+        for (std::size_t i = 0; i < keep; ++i) {
+            const std::size_t idx = order[i];
+            if (idx < numOld) {
+                U.push_back(std::move(U_[idx]));
+                C.push_back(std::move(C_[idx]));
+            } else {
+                U.push_back(std::move(cycleU[idx - numOld]));
+                C.push_back(std::move(cycleC[idx - numOld]));
+            }
+        }
+        U_ = std::move(U);
+        C_ = std::move(C);
+    }
+
+    LinearOperator<X, X>& op_;
+    ScalarProduct<X>& sp_;
+    Preconditioner<X, X>& prec_;
+    double reduction_;
+    int restart_;
+    int recycleSize_;
+    int maxit_;
+    int verbose_;
+    std::vector<X> U_;
+    std::vector<X> C_;
+};
+
+} // namespace Dune
+
+#endif // OPM_RECYCLINGGCRSOLVER_HEADER_INCLUDED
@@ -21,18 +21,20 @@
 #define OPM_WRITESYSTEMMATRIXHELPER_HEADER_INCLUDED
 
 #include <dune/istl/matrixmarket.hh>
+#include <opm/simulators/linalg/BinaryLinearSystem.hpp>
 #include <opm/simulators/linalg/MatrixMarketSpecializations.hpp>
 
+#include <string>
+
 
 namespace Opm
 {
 namespace Helper
 {
-    template <class SimulatorType, class MatrixType, class VectorType, class Communicator>
-    void writeSystem(const SimulatorType& simulator,
-                     const MatrixType& matrix,
-                     const VectorType& rhs,
-                     [[maybe_unused]] const Communicator* comm)
+    /// Common prefix (including directory) of the files the linear
+    /// system of the current Newton iteration is written to.
+    template <class SimulatorType>
+    std::string systemFilePrefix(const SimulatorType& simulator)
     {
         std::string dir = simulator.problem().outputDir();
         if (dir == ".") {
@@ -55,7 +57,16 @@ namespace Helper
         oss << "_nit_" << nit << "_";
         std::string output_file(oss.str());
         fs::path full_path = output_dir / output_file;
-        std::string prefix = full_path.string();
+        return full_path.string();
+    }
+
+    template <class SimulatorType, class MatrixType, class VectorType, class Communicator>
+    void writeSystem(const SimulatorType& simulator,
+                     const MatrixType& matrix,
+                     const VectorType& rhs,
+                     [[maybe_unused]] const Communicator* comm)
+    {
+        const std::string prefix = systemFilePrefix(simulator);
         {
             std::string filename = prefix + "matrix_istl";
 #if HAVE_MPI
@@ -80,6 +91,26 @@ namespace Helper
         }
     }
 
+    /// Write the linear system in the binary format of
+    /// writeBinaryLinearSystem(), which is much smaller and faster to write
+    /// and read than MatrixMarket. In parallel runs each process writes
+    /// its local system to a file of its own.
+    template <class SimulatorType, class MatrixType, class VectorType, class Communicator>
+    void writeBinarySystem(const SimulatorType& simulator,
+                           const MatrixType& matrix,
+                           const VectorType& rhs,
+                           const MatrixType* wells,
+                           const VectorType* weights,
+                           [[maybe_unused]] const Communicator* comm)
+    {
+        std::string filename = systemFilePrefix(simulator) + "system";
+#if HAVE_MPI
+        if (comm != nullptr) { // comm is not set in serial runs
+            filename += "_rank" + std::to_string(comm->communicator().rank());
+        }
+#endif
+        writeBinaryLinearSystem(filename + ".bin", matrix, rhs, wells, weights);
+    }
 
 } // namespace Helper
 } // namespace Opm
@@ -472,7 +472,6 @@ namespace Dune
     void AMGCPR<M,X,S,PI,A>::update()
     {
       Timer watch;
-      smoothers_.reset(new Hierarchy<Smoother,A>);
       solver_.reset();
       coarseSmoother_.reset();
       scalarProduct_.reset();
@@ -463,6 +463,21 @@ public:
     }
   }
 
+  /**
+   * @brief Recompute the values of the coarse level system and its solver.
+   *
+   * The smoother is kept and the sparsity pattern of the coarse level
+   * matrix is reused, as is the coarsening (aggregates) of a coarse
+   * level AMG. Requires that the coarse level system has been created
+   * and that the sparsity pattern of the fine level matrix is unchanged.
+   */
+  void updateCoarseValues()
+  {
+    assert(coarseSolver_);
+    policy_->calculateCoarseEntries(*operator_);
+    coarseSolver_->updatePreconditioner();
+  }
+
   void pre(FineDomainType& x, FineRangeType& b)
   {
     smoother_->pre(x,b);
@@ -46,6 +46,9 @@ namespace Opm
           total_linearizations( 0 ),
           total_newton_iterations( 0 ),
           total_linear_iterations( 0 ),
+          total_single_precision_linear_solves( 0 ),
+          total_single_precision_linear_iterations( 0 ),
+          total_saved_linear_iterations( 0 ),
           converged(false),
           exit_status(EXIT_SUCCESS),
           global_time(0),
@@ -70,6 +73,9 @@ namespace Opm
         total_linearizations += sr.total_linearizations;
         total_newton_iterations += sr.total_newton_iterations;
         total_linear_iterations += sr.total_linear_iterations;
+        total_single_precision_linear_solves += sr.total_single_precision_linear_solves;
+        total_single_precision_linear_iterations += sr.total_single_precision_linear_iterations;
+        total_saved_linear_iterations += sr.total_saved_linear_iterations;
         // It makes no sense adding time points. Therefore, do not 
         // overwrite the value of global_time which gets set in 
         // NonlinearSolverEbos.hpp by the line:
@@ -88,6 +94,9 @@ namespace Opm
                           assemble_time,
                           total_linear_iterations,
                           linear_solve_time);
+        if (total_saved_linear_iterations != 0) {
+            ss << fmt::format(", est. saved linear its={:3}", total_saved_linear_iterations);
+        }
     }
 
     void SimulatorReportSingle::reportFullyImplicit(std::ostream& os, const SimulatorReportSingle* failureReport) const
@@ -185,6 +194,30 @@ namespace Opm
                             100.0*failureReport->total_linear_iterations/n);
         }
         os << std::endl;
+
+        const unsigned int spSolves = total_single_precision_linear_solves
+            + (failureReport ? failureReport->total_single_precision_linear_solves : 0);
+        if (spSolves > 0) {
+            // Compare the average iteration count of single and double precision
+            // preconditioned solves. Each Newton iteration does one linear solve.
+            const unsigned int spIts = total_single_precision_linear_iterations
+                + (failureReport ? failureReport->total_single_precision_linear_iterations : 0);
+            const unsigned int solves = total_newton_iterations
+                + (failureReport ? failureReport->total_newton_iterations : 0);
+            os << fmt::format(" Single precision prec.:   {:7} ({} solves, {:.1f} its/solve",
+                              spIts, spSolves, static_cast<double>(spIts)/spSolves);
+            if (solves > spSolves) {
+                os << fmt::format("; double precision: {:.1f} its/solve",
+                                  static_cast<double>(n - spIts)/(solves - spSolves));
+            }
+            os << ")" << std::endl;
+        }
+
+        const unsigned int savedIts = total_saved_linear_iterations
+            + (failureReport ? failureReport->total_saved_linear_iterations : 0);
+        if (savedIts > 0) {
+            os << fmt::format(" Est. saved by inexact Newton: {:7}", savedIts) << std::endl;
+        }
     }
 
     void SimulatorReport::operator+=(const SimulatorReportSingle& sr)
@@ -45,6 +45,11 @@ namespace Opm
         unsigned int total_linearizations;
         unsigned int total_newton_iterations;
         unsigned int total_linear_iterations;
+        /// Linear solves (and their iterations) done with a single precision preconditioner.
+        unsigned int total_single_precision_linear_solves;
+        unsigned int total_single_precision_linear_iterations;
+        /// Estimated linear iterations saved by inexact (Eisenstat-Walker) linear solves.
+        unsigned int total_saved_linear_iterations;
 
         bool converged;
         int exit_status;
@@ -84,6 +84,10 @@ enum ExcEnum {
         /// Clear the message container without logging them.
         void clearMessages();
 
+        /// Move all messages of other to the end of this logger,
+        /// e.g. to merge loggers that were used by separate threads.
+        void append(DeferredLogger& other);
+
     private:
         std::vector<Message> messages_;
         friend DeferredLogger gatherDeferredLogger(const DeferredLogger& local_deferredlogger);
@@ -0,0 +1,402 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/simulators/utils/DistributedRestart.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/FileSystem.hpp>
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/output/data/Cells.hpp>
+#include <opm/output/data/Solution.hpp>
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+
+#include <cstddef>
+#include <iomanip>
+#include <ios>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+
+template <typename T>
+std::vector<T> localValues(const Opm::data::CellData& cellData,
+                           const std::vector<int>& localCells,
+                           const Opm::UnitSystem& units)
+{
+    std::vector<T> values;
+    values.reserve(localCells.size());
+    for (const int cell : localCells)
+        values.push_back(static_cast<T>(units.from_si(cellData.dim, cellData.data[cell])));
+    return values;
+}
+
+template <typename T>
+void scatterToGlobal(const std::string& name,
+                     const std::vector<T>& localValues,
+                     const std::vector<int>& globalIndex,
+                     std::vector<T>& globalValues)
+{
+    if (localValues.size() != globalIndex.size())
+        OPM_THROW(std::runtime_error, "Array " << name << " has " << localValues.size()
+                  << " values but there are " << globalIndex.size() << " cells in the partition");
+
+    for (std::size_t i = 0; i < globalIndex.size(); ++i)
+        globalValues[globalIndex[i]] = localValues[i];
+}
+
+// The partition file of one rank. The file is opened once, the arrays are
+// loaded when they are merged.
+struct Partition
+{
+    explicit Partition(const std::string& fileName)
+        : file(fileName)
+        , arrays(file.getList())
+    {
+        if (arrays.size() < 2 || std::get<0>(arrays[0]) != "DRSTHEAD" ||
+            std::get<0>(arrays[1]) != "GLOBIDX")
+            OPM_THROW(std::runtime_error, "Missing header in the distributed restart file " << fileName);
+
+        const auto& head = file.get<int>(0);
+        numGlobalCells = head[0];
+        globalIndex = file.get<int>(1);
+        if (head[1] != static_cast<int>(globalIndex.size()))
+            OPM_THROW(std::runtime_error, "The distributed restart file " << fileName << " has "
+                      << globalIndex.size() << " global indices for " << head[1] << " cells");
+
+        for (std::size_t i = 2; i < arrays.size(); ++i) {
+            if (std::get<0>(arrays[i]) == "SEQNUM") {
+                reportSteps.push_back(file.get<int>(i)[0]);
+                stepBegin.push_back(i);
+            }
+        }
+    }
+
+    Opm::EclIO::EclFile file;
+    std::vector<Opm::EclIO::EclFile::EclEntry> arrays;
+    int numGlobalCells;
+    std::vector<int> globalIndex;
+    std::vector<int> reportSteps;
+    // position of the SEQNUM record of every report step
+    std::vector<std::size_t> stepBegin;
+};
+
+// The merged arrays of one report step in global cell order.
+struct MergedStep
+{
+    // names in the order of first appearance in the partitions
+    std::vector<std::string> solution;
+    std::vector<std::string> auxiliary;
+    std::map<std::string, std::vector<float>> floatArrays;
+    std::map<std::string, std::vector<double>> doubleArrays;
+
+    bool contains(const std::string& name) const
+    {
+        return floatArrays.count(name) > 0 || doubleArrays.count(name) > 0;
+    }
+
+    void write(Opm::EclIO::EclOutput& output, const std::vector<std::string>& names) const
+    {
+        for (const auto& name : names) {
+            if (auto it = floatArrays.find(name); it != floatArrays.end())
+                output.write(name, it->second);
+            else
+                output.write(name, doubleArrays.at(name));
+        }
+    }
+};
+
+// Merge the arrays of report step @step of all partitions. The arrays are
+// the union over the partitions, cells of partitions without an array are
+// zero.
+MergedStep mergeStep(std::vector<Partition>& partitions, std::size_t step, int numGlobalCells)
+{
+    MergedStep merged;
+    for (std::size_t rank = 0; rank < partitions.size(); ++rank) {
+        auto& part = partitions[rank];
+        const std::size_t begin = part.stepBegin[step];
+        const std::size_t end = step + 1 < part.stepBegin.size() ? part.stepBegin[step + 1] : part.arrays.size();
+        const int reportStep = part.reportSteps[step];
+
+        if (begin + 2 > end || std::get<0>(part.arrays[begin + 1]) != "STARTSOL")
+            OPM_THROW(std::runtime_error, "Missing STARTSOL in the distributed restart file of rank "
+                      << rank << " at report step " << reportStep);
+
+        bool inSolution = true;
+        for (std::size_t i = begin + 2; i < end; ++i) {
+            const auto& [name, type, size] = part.arrays[i];
+            if (name == "ENDSOL") {
+                inSolution = false;
+                continue;
+            }
+
+            if (!merged.contains(name))
+                (inSolution ? merged.solution : merged.auxiliary).push_back(name);
+
+            if (type == Opm::EclIO::REAL && merged.doubleArrays.count(name) == 0) {
+                auto& values = merged.floatArrays[name];
+                values.resize(numGlobalCells);
+                scatterToGlobal(name, part.file.get<float>(i), part.globalIndex, values);
+            }
+            else if (type == Opm::EclIO::DOUB && merged.floatArrays.count(name) == 0) {
+                auto& values = merged.doubleArrays[name];
+                values.resize(numGlobalCells);
+                scatterToGlobal(name, part.file.get<double>(i), part.globalIndex, values);
+            }
+            else
+                OPM_THROW(std::runtime_error, "Unexpected type of array " << name
+                          << " in the distributed restart file of rank " << rank
+                          << " at report step " << reportStep);
+        }
+
+        if (inSolution)
+            OPM_THROW(std::runtime_error, "Missing ENDSOL in the distributed restart file of rank "
+                      << rank << " at report step " << reportStep);
+    }
+
+    return merged;
+}
+
+void copyArray(Opm::EclIO::EclFile& input,
+               int index,
+               const Opm::EclIO::EclFile::EclEntry& array,
+               Opm::EclIO::EclOutput& output)
+{
+    const auto& [name, type, size] = array;
+    switch (type) {
+    case Opm::EclIO::INTE:
+        output.write(name, input.get<int>(index));
+        break;
+    case Opm::EclIO::REAL:
+        output.write(name, input.get<float>(index));
+        break;
+    case Opm::EclIO::DOUB:
+        output.write(name, input.get<double>(index));
+        break;
+    case Opm::EclIO::LOGI:
+        output.write(name, input.get<bool>(index));
+        break;
+    case Opm::EclIO::CHAR:
+        output.write(name, input.get<std::string>(index));
+        break;
+    case Opm::EclIO::MESS:
+        output.message(name);
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Unsupported type of array " << name << " in the restart file");
+    }
+}
+
+// Rewrite the restart file @fileName with the merged arrays of the
+// partitions in the solution section of the report steps of @steps, which
+// maps the report step to its position in the partition files. The steps
+// are merged one at a time. Returns the number of report steps found.
+std::size_t spliceIntoRestartFile(const std::string& fileName,
+                                  bool formatted,
+                                  std::vector<Partition>& partitions,
+                                  const std::map<int, std::size_t>& steps)
+{
+    Opm::EclIO::EclFile input(fileName);
+    const auto arrays = input.getList();
+    const std::string tmpFileName = fileName + ".tmp";
+    const int numGlobalCells = partitions[0].numGlobalCells;
+
+    std::size_t numFound = 0;
+    {
+        Opm::EclIO::EclOutput output(tmpFileName, formatted);
+
+        enum class Section { Header, Solution, Auxiliary };
+        std::optional<MergedStep> merged;
+        Section section = Section::Header;
+        for (std::size_t i = 0; i < arrays.size(); ++i) {
+            const auto& name = std::get<0>(arrays[i]);
+            if (name == "SEQNUM") {
+                merged.reset();
+                if (auto it = steps.find(input.get<int>(i)[0]); it != steps.end()) {
+                    merged = mergeStep(partitions, it->second, numGlobalCells);
+                    ++numFound;
+                }
+                section = Section::Header;
+            }
+            else if (merged && name == "STARTSOL") {
+                copyArray(input, i, arrays[i], output);
+                merged->write(output, merged->solution);
+                section = Section::Solution;
+                continue;
+            }
+            else if (merged && name == "ENDSOL") {
+                copyArray(input, i, arrays[i], output);
+                merged->write(output, merged->auxiliary);
+                section = Section::Auxiliary;
+                continue;
+            }
+            // replaced by the merged array
+            else if (merged && section != Section::Header && merged->contains(name))
+                continue;
+
+            copyArray(input, i, arrays[i], output);
+        }
+    }
+
+    Opm::filesystem::rename(tmpFileName, fileName);
+    return numFound;
+}
+
+std::string restartFileName(const std::string& basePath, int reportStep, bool unified, bool formatted)
+{
+    if (unified)
+        return basePath + (formatted ? ".FUNRST" : ".UNRST");
+
+    std::ostringstream name;
+    name << basePath << (formatted ? ".F" : ".X") << std::setw(4) << std::setfill('0') << reportStep;
+    return name.str();
+}
+
+}
+
+namespace Opm {
+
+std::string distributedRestartFileName(const std::string& basePath, int rank)
+{
+    return basePath + ".P" + std::to_string(rank) + ".DRST";
+}
+
+void writeDistributedRestartStep(const std::string& fileName,
+                                 bool append,
+                                 int reportStep,
+                                 int numGlobalCells,
+                                 const std::vector<int>& localCells,
+                                 const std::vector<int>& globalIndex,
+                                 const data::Solution& solution,
+                                 const UnitSystem& units,
+                                 bool doublePrecision,
+                                 bool eclCompatible)
+{
+    EclIO::EclOutput output(fileName, false, append ? std::ios::app : std::ios::out);
+
+    if (!append) {
+        const int numLocalCells = localCells.size();
+        output.write<int>("DRSTHEAD", {numGlobalCells, numLocalCells});
+        output.write<int>("GLOBIDX", globalIndex);
+    }
+
+    auto writeArrays = [&](data::TargetType target)
+    {
+        for (const auto& [key, cellData] : solution) {
+            if (cellData.target != target)
+                continue;
+
+            if (doublePrecision)
+                output.write(key, localValues<double>(cellData, localCells, units));
+            else
+                output.write(key, localValues<float>(cellData, localCells, units));
+        }
+    };
+
+    output.write<int>("SEQNUM", {reportStep});
+    output.message("STARTSOL");
+    writeArrays(data::TargetType::RESTART_SOLUTION);
+    output.message("ENDSOL");
+    if (!eclCompatible)
+        writeArrays(data::TargetType::RESTART_AUXILIARY);
+}
+
+int mergeDistributedRestart(const std::string& basePath, int numRanks)
+{
+    if (numRanks == 0) {
+        while (filesystem::exists(distributedRestartFileName(basePath, numRanks)))
+            ++numRanks;
+    }
+    if (numRanks == 0)
+        OPM_THROW(std::runtime_error, "No distributed restart files found for " << basePath);
+
+    std::vector<Partition> partitions;
+    partitions.reserve(numRanks);
+    for (int rank = 0; rank < numRanks; ++rank) {
+        partitions.emplace_back(distributedRestartFileName(basePath, rank));
+        const auto& part = partitions.back();
+        if (part.numGlobalCells != partitions[0].numGlobalCells ||
+            part.reportSteps != partitions[0].reportSteps)
+            OPM_THROW(std::runtime_error, "The distributed restart file of rank " << rank
+                      << " does not match the one of rank 0");
+    }
+
+    // every global cell must belong to exactly one partition
+    const int numGlobalCells = partitions[0].numGlobalCells;
+    std::vector<int> owner(numGlobalCells, -1);
+    for (int rank = 0; rank < numRanks; ++rank) {
+        for (const int globalIdx : partitions[rank].globalIndex) {
+            if (globalIdx < 0 || globalIdx >= numGlobalCells)
+                OPM_THROW(std::runtime_error, "Global cell index " << globalIdx << " of rank " << rank
+                          << " is outside of the " << numGlobalCells << " global cells");
+            if (owner[globalIdx] >= 0)
+                OPM_THROW(std::runtime_error, "Global cell " << globalIdx << " is in the partitions of rank "
+                          << owner[globalIdx] << " and rank " << rank);
+            owner[globalIdx] = rank;
+        }
+    }
+    for (int globalIdx = 0; globalIdx < numGlobalCells; ++globalIdx) {
+        if (owner[globalIdx] < 0)
+            OPM_THROW(std::runtime_error, "Global cell " << globalIdx << " is not in any partition");
+    }
+
+    const auto& reportSteps = partitions[0].reportSteps;
+    const int numSteps = reportSteps.size();
+
+    // The unified restart file is rewritten once with all report steps,
+    // otherwise each report step has its own file.
+    for (const bool formatted : {false, true}) {
+        const auto fileName = restartFileName(basePath, 0, true, formatted);
+        if (!filesystem::exists(fileName))
+            continue;
+
+        std::map<int, std::size_t> steps;
+        for (std::size_t step = 0; step < reportSteps.size(); ++step)
+            steps.emplace(reportSteps[step], step);
+
+        if (spliceIntoRestartFile(fileName, formatted, partitions, steps) != steps.size())
+            OPM_THROW(std::runtime_error, "The restart file " << fileName
+                      << " does not have all report steps of the distributed restart files");
+        return numSteps;
+    }
+
+    for (std::size_t step = 0; step < reportSteps.size(); ++step) {
+        const int reportStep = reportSteps[step];
+        bool found = false;
+        for (const bool formatted : {false, true}) {
+            const auto fileName = restartFileName(basePath, reportStep, false, formatted);
+            if (filesystem::exists(fileName)) {
+                found = spliceIntoRestartFile(fileName, formatted, partitions, {{reportStep, step}}) == 1;
+                break;
+            }
+        }
+        if (!found)
+            OPM_THROW(std::runtime_error, "No restart file with report step " << reportStep
+                      << " found for " << basePath);
+    }
+
+    return numSteps;
+}
+
+}
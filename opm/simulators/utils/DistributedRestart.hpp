@@ -0,0 +1,86 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DISTRIBUTEDRESTART_HEADER_INCLUDED
+#define OPM_DISTRIBUTEDRESTART_HEADER_INCLUDED
+
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+namespace data { class Solution; }
+class UnitSystem;
+
+/*
+  Distributed restart output: instead of gathering the cell arrays of the
+  restart solution on the I/O rank, every rank writes the arrays of its own
+  interior cells to the file <base>.P<rank>.DRST, while the I/O rank writes
+  the restart file without cell arrays. The partition files use the binary
+  ECL keyword format and start with
+
+     DRSTHEAD : INTE [number of global cells, number of local cells]
+     GLOBIDX  : INTE global (active) cell index of each local cell
+
+  followed by one section per restart report step which has the layout of
+  the solution part of a restart file, in local cell order:
+
+     SEQNUM   : INTE [report step]
+     STARTSOL : MESS
+     <key>    : REAL or DOUB, the RESTART_SOLUTION arrays
+     ENDSOL   : MESS
+     <key>    : REAL or DOUB, the RESTART_AUXILIARY arrays, unless the
+                restart file is ECLIPSE compatible
+
+  mergeDistributedRestart() assembles the partitions in global cell order
+  and splices them into the restart files <base>.UNRST or <base>.Xnnnn
+  (or their formatted counterparts) written by EclipseIO.
+*/
+
+/// Name of the partition file written by rank @rank for the case with
+/// output base path @basePath, i.e. output dir and case name.
+std::string distributedRestartFileName(const std::string& basePath, int rank);
+
+/// Write the restart arrays of @solution for the cells @localCells to
+/// @fileName, converted to the output units @units like in the restart file.
+/// Unless @append is true the file is truncated and starts with the header
+/// and the global index @globalIndex. The RESTART_AUXILIARY arrays are only
+/// written if @eclCompatible is false, as in the restart file.
+void writeDistributedRestartStep(const std::string& fileName,
+                                 bool append,
+                                 int reportStep,
+                                 int numGlobalCells,
+                                 const std::vector<int>& localCells,
+                                 const std::vector<int>& globalIndex,
+                                 const data::Solution& solution,
+                                 const UnitSystem& units,
+                                 bool doublePrecision,
+                                 bool eclCompatible);
+
+/// Merge the partition files of all ranks for @basePath in global cell
+/// order and write the arrays into the STARTSOL/ENDSOL blocks of the
+/// matching report steps of the restart files of @basePath. Arrays of the
+/// same name already in the restart file are replaced. If @numRanks is zero
+/// the number of ranks is the number of consecutive partition files found.
+/// Returns the number of merged report steps.
+int mergeDistributedRestart(const std::string& basePath, int numRanks = 0);
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_THREADEDFOREACH_HEADER_INCLUDED
+#define OPM_THREADEDFOREACH_HEADER_INCLUDED
+
+#include <opm/simulators/utils/DeferredLogger.hpp>
+
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Call func(i, logger) for i = 0, ..., n-1 using all OpenMP threads.
+    ///
+    /// The indices for which serial(i) is true are left out of the threaded
+    /// loop and processed afterwards by the calling thread in increasing
+    /// order, e.g. because they communicate. Every index gets its own logger,
+    /// and the loggers are appended to deferred_logger in index order. The
+    /// first exception (in index order) is rethrown after all indices are
+    /// processed. The outcome therefore does not depend on the number of
+    /// threads, as long as the calls for different indices are independent.
+    template <class Func, class SerialPredicate>
+    void threadedForEach(const int n, Func&& func, SerialPredicate&& serial,
+                         DeferredLogger& deferred_logger)
+    {
+        std::vector<DeferredLogger> loggers(n);
+        std::vector<std::exception_ptr> exceptions(n);
+        std::vector<char> run_serially(n);
+        for (int i = 0; i < n; ++i) {
+            run_serially[i] = serial(i);
+        }
+
+        auto process = [&](const int i) {
+            try {
+                func(i, loggers[i]);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        };
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < n; ++i) {
+            if (!run_serially[i]) {
+                process(i);
+            }
+        }
+        for (int i = 0; i < n; ++i) {
+            if (run_serially[i]) {
+                process(i);
+            }
+        }
+
+        for (auto& logger : loggers) {
+            deferred_logger.append(logger);
+        }
+        for (const auto& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
+    /// Call func(i, logger) for i = 0, ..., n-1 using all OpenMP threads.
+    template <class Func>
+    void threadedForEach(const int n, Func&& func, DeferredLogger& deferred_logger)
+    {
+        threadedForEach(n, std::forward<Func>(func), [](int) { return false; }, deferred_logger);
+    }
+
+} // namespace Opm
+
+#endif // OPM_THREADEDFOREACH_HEADER_INCLUDED
@@ -263,6 +263,10 @@ namespace Opm {
                 }
             }
 
+            // the well contributions -C^T D^-1 B of all wells as a separate matrix,
+            // with nonzeros only between cells perforated by the same well
+            std::unique_ptr<SparseMatrixAdapter> wellContributionMatrix(const std::size_t numCells) const;
+
             // called at the beginning of a report step
             void beginReportStep(const int time_step);
 
@@ -281,6 +285,15 @@ namespace Opm {
             WellInterfacePtr getWell(const std::string& well_name) const;
             void initGliftEclWellMap(GLiftEclWells &ecl_well_map);
 
+            // whether apply() and applyScaleAdd() use batched_well_contributions_
+            bool useBatchedWellContributions() const
+            {
+                return param_.use_batched_well_contributions_ && !param_.matrix_add_well_contributions_;
+            }
+
+            // pack the linearized standard wells into batched_well_contributions_
+            void updateBatchedWellContributions();
+
         protected:
             Simulator& ebosSimulator_;
 
@@ -319,11 +332,13 @@ namespace Opm {
 
             SimulatorReportSingle last_report_{};
 
-            // used to better efficiency of calcuation
-            mutable BVector scaleAddRes_{};
-
             std::vector<Scalar> B_avg_{};
 
+            // the contributions of all standard wells packed for a single apply loop,
+            // and the wells that still have to be applied one by one
+            typename StandardWell<TypeTag>::BatchedContributions batched_well_contributions_{};
+            std::vector<const WellInterface<TypeTag>*> unbatched_wells_{};
+
             const Grid& grid() const
             { return ebosSimulator_.vanguard().grid(); }
 
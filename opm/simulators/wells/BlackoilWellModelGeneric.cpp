@@ -829,6 +829,7 @@ checkGroupHigherConstraints(const Group& group,
                     phase_usage_,
                     group.getGroupEfficiencyFactor(),
                     schedule(),
+                    this->groupTree(),
                     summaryState_,
                     resv_coeff_inj,
                     deferred_logger);
@@ -866,6 +867,7 @@ checkGroupHigherConstraints(const Group& group,
                     phase_usage_,
                     group.getGroupEfficiencyFactor(),
                     schedule(),
+                    this->groupTree(),
                     summaryState_,
                     resv_coeff,
                     deferred_logger);
@@ -1032,6 +1034,10 @@ BlackoilWellModelGeneric::
 updateEclWells(const int timeStepIdx,
                const std::unordered_set<std::string>& wells)
 {
+    // The schedule has been changed by an action. The tree is rebuilt right
+    // away, in place, since the wells keep a pointer to it.
+    this->group_tree_.emplace(schedule(), timeStepIdx);
+
     for (const auto& wname : wells) {
         auto well_iter = std::find_if( this->wells_ecl_.begin(), this->wells_ecl_.end(), [wname] (const auto& well) -> bool { return well.name() == wname;});
         if (well_iter != this->wells_ecl_.end()) {
@@ -1510,16 +1516,17 @@ updateAndCommunicateGroupData(const int reportStepIdx,
     const auto& well_state_nupcol = this->nupcolWellState();
     // the group target reduction rates needs to be update since wells may have switched to/from GRUP control
     // Currently the group target reduction does not honor NUPCOL. TODO: is that true?
+    const auto& group_tree = this->groupTree(reportStepIdx);
     std::vector<double> groupTargetReduction(numPhases(), 0.0);
-    WellGroupHelpers::updateGroupTargetReduction(fieldGroup, schedule(), reportStepIdx, /*isInjector*/ false, phase_usage_, guideRate_, well_state_nupcol, well_state, this->groupState(), groupTargetReduction);
+    WellGroupHelpers::updateGroupTargetReduction(fieldGroup, schedule(), reportStepIdx, /*isInjector*/ false, phase_usage_, guideRate_, group_tree, well_state_nupcol, well_state, this->groupState(), groupTargetReduction);
     std::vector<double> groupTargetReductionInj(numPhases(), 0.0);
-    WellGroupHelpers::updateGroupTargetReduction(fieldGroup, schedule(), reportStepIdx, /*isInjector*/ true, phase_usage_, guideRate_, well_state_nupcol, well_state, this->groupState(), groupTargetReductionInj);
+    WellGroupHelpers::updateGroupTargetReduction(fieldGroup, schedule(), reportStepIdx, /*isInjector*/ true, phase_usage_, guideRate_, group_tree, well_state_nupcol, well_state, this->groupState(), groupTargetReductionInj);
 
-    WellGroupHelpers::updateREINForGroups(fieldGroup, schedule(), reportStepIdx, phase_usage_, summaryState_, well_state_nupcol, well_state, this->groupState());
-    WellGroupHelpers::updateVREPForGroups(fieldGroup, schedule(), reportStepIdx, well_state_nupcol, well_state, this->groupState());
+    WellGroupHelpers::updateREINForGroups(group_tree, schedule(), phase_usage_, summaryState_, well_state_nupcol, well_state, this->groupState());
+    WellGroupHelpers::updateVREPForGroups(group_tree, well_state_nupcol, well_state, this->groupState());
 
-    WellGroupHelpers::updateReservoirRatesInjectionGroups(fieldGroup, schedule(), reportStepIdx, well_state_nupcol, well_state, this->groupState());
-    WellGroupHelpers::updateGroupProductionRates(fieldGroup, schedule(), reportStepIdx, well_state_nupcol, well_state, this->groupState());
+    WellGroupHelpers::updateReservoirRatesInjectionGroups(group_tree, well_state_nupcol, well_state, this->groupState());
+    WellGroupHelpers::updateGroupProductionRates(group_tree, well_state_nupcol, well_state, this->groupState());
 
     // We use the rates from the previous time-step to reduce oscillations
     WellGroupHelpers::updateWellRates(fieldGroup, schedule(), reportStepIdx, this->prevWellState(), well_state);
@@ -1539,6 +1546,16 @@ updateAndCommunicateGroupData(const int reportStepIdx,
     updateWsolvent(fieldGroup, reportStepIdx,  well_state_nupcol);
 }
 
+const GroupTree&
+BlackoilWellModelGeneric::
+groupTree(const int reportStepIdx)
+{
+    if (!this->group_tree_ || this->group_tree_->reportStep() != reportStepIdx) {
+        this->group_tree_.emplace(schedule(), reportStepIdx);
+    }
+    return *this->group_tree_;
+}
+
 bool
 BlackoilWellModelGeneric::
 hasTHPConstraints() const
@@ -27,6 +27,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -37,6 +38,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/Group/GuideRate.hpp>
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
+#include <opm/simulators/wells/GroupTree.hpp>
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
 #include <opm/simulators/wells/PerforationData.hpp>
 #include <opm/simulators/wells/WellInterfaceGeneric.hpp>
@@ -331,6 +333,17 @@ protected:
     void updateAndCommunicateGroupData(const int reportStepIdx,
                                        const int iterationIdx);
 
+    /// The group tree of report step @reportStepIdx, rebuilt if the cached
+    /// one is of another report step.
+    const GroupTree& groupTree(const int reportStepIdx);
+
+    /// The cached group tree if there is one. The address does not change
+    /// when the tree is rebuilt, so the wells can keep it.
+    const GroupTree* groupTree() const
+    {
+        return this->group_tree_ ? &*this->group_tree_ : nullptr;
+    }
+
     void inferLocalShutWells();
 
     void setRepRadiusPerfLength();
@@ -382,6 +395,10 @@ protected:
 
     std::optional<int> last_run_wellpi_{};
 
+    // The group tree of the current report step, built on first use and
+    // rebuilt in place.
+    std::optional<GroupTree> group_tree_{};
+
     std::vector<Well> wells_ecl_;
     std::vector<std::vector<PerforationData>> well_perf_data_;
     std::function<bool(const Well&)> not_on_process_{};
@@ -21,6 +21,7 @@
 */
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
+#include <opm/simulators/utils/threadedForEach.hpp>
 #include <opm/core/props/phaseUsageFromDeck.hpp>
 
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
@@ -142,6 +143,25 @@ namespace Opm {
         }
     }
 
+    template<typename TypeTag>
+    std::unique_ptr<typename BlackoilWellModel<TypeTag>::SparseMatrixAdapter>
+    BlackoilWellModel<TypeTag>::
+    wellContributionMatrix(const std::size_t numCells) const
+    {
+        std::vector<NeighborSet> neighbors(numCells);
+        for (const auto& well : well_container_) {
+            const auto& cells = well->cells();
+            for (const int cellIdx : cells) {
+                neighbors[cellIdx].insert(cells.begin(), cells.end());
+            }
+        }
+        auto matrix = std::make_unique<SparseMatrixAdapter>(numCells, numCells);
+        matrix->reserve(neighbors);
+        matrix->clear();
+        addWellContributions(*matrix);
+        return matrix;
+    }
+
     template<typename TypeTag>
     void
     BlackoilWellModel<TypeTag>::
@@ -157,6 +177,9 @@ namespace Opm {
                 // r = r - duneC_^T * invDuneD_ * resWell_
                 well->apply(res);
             }
+            if (useBatchedWellContributions()) {
+                updateBatchedWellContributions();
+            }
             return;
         }
 
@@ -287,6 +310,7 @@ namespace Opm {
         for (auto& well : well_container_) {
             well->setVFPProperties(vfp_properties_.get());
             well->setGuideRate(&guideRate_);
+            well->setGroupTree(this->groupTree());
         }
 
         // Close completions due to economical reasons
@@ -396,6 +420,7 @@ namespace Opm {
                 well->setWellEfficiencyFactor(well_efficiency_factor);
                 well->setVFPProperties(vfp_properties_.get());
                 well->setGuideRate(&guideRate_);
+                well->setGroupTree(this->groupTree());
 
                 const WellTestConfig::Reason testing_reason = testWell.second;
 
@@ -1023,9 +1048,31 @@ namespace Opm {
     BlackoilWellModel<TypeTag>::
     assembleWellEq(const double dt, DeferredLogger& deferred_logger)
     {
+        // The operability check of a multisegment producer solves a copy of the
+        // well against a copy of the whole well state, so it would read entries
+        // other wells are writing. It is cheap compared to the well solves and is
+        // done for all wells before the threaded loop.
+        std::vector<char> old_well_operable(this->wellState().size());
         for (auto& well : well_container_) {
-            well->assembleWellEq(ebosSimulator_, dt, this->wellState(), this->groupState(), deferred_logger);
-        }
+            old_well_operable[well->indexOfWell()] = well->isOperable();
+            well->checkWellOperability(ebosSimulator_, this->wellState(), deferred_logger);
+        }
+
+        // After the check the wells only write their own entries of the well state
+        // and only read the group state, so they can be assembled (and locally
+        // solved) in parallel. Distributed wells communicate while being assembled,
+        // so they are processed after the threaded loop, in the same order on all
+        // processes.
+        threadedForEach(well_container_.size(),
+                        [this, dt, &old_well_operable](const int w, DeferredLogger& well_logger) {
+                            auto& well = *well_container_[w];
+                            well.assembleWellEqAfterOperabilityCheck(ebosSimulator_, dt, old_well_operable[well.indexOfWell()],
+                                                                     this->wellState(), this->groupState(), well_logger);
+                        },
+                        [this](const int w) {
+                            return well_container_[w]->parallelWellInfo().communication().size() > 1;
+                        },
+                        deferred_logger);
     }
 
     template<typename TypeTag>
@@ -1054,6 +1101,14 @@ namespace Opm {
             return;
         }
 
+        if (useBatchedWellContributions()) {
+            batched_well_contributions_.applyScaleAdd(1.0, x, Ax);
+            for (const auto* well : unbatched_wells_) {
+                well->apply(x, Ax);
+            }
+            return;
+        }
+
         for (auto& well : well_container_) {
             well->apply(x, Ax);
         }
@@ -1099,6 +1154,21 @@ namespace Opm {
     }
 #endif
 
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    updateBatchedWellContributions()
+    {
+        batched_well_contributions_.clear();
+        unbatched_wells_.clear();
+        for (const auto& well : well_container_) {
+            const auto* std_well = dynamic_cast<const StandardWell<TypeTag>*>(well.get());
+            if (!std_well || !std_well->addWellContribution(batched_well_contributions_)) {
+                unbatched_wells_.push_back(well.get());
+            }
+        }
+    }
+
     // Ax = Ax - alpha * C D^-1 B x
     template<typename TypeTag>
     void
@@ -1109,15 +1179,20 @@ namespace Opm {
             return;
         }
 
-        if( scaleAddRes_.size() != Ax.size() ) {
-            scaleAddRes_.resize( Ax.size() );
+        if (useBatchedWellContributions()) {
+            batched_well_contributions_.applyScaleAdd(alpha, x, Ax);
+            for (const auto* well : unbatched_wells_) {
+                well->applyScaleAdd(alpha, x, Ax);
+            }
+            return;
         }
 
-        scaleAddRes_ = 0.0;
-        // scaleAddRes_  = - C D^-1 B x
-        apply( x, scaleAddRes_ );
-        // Ax = Ax + alpha * scaleAddRes_
-        Ax.axpy( alpha, scaleAddRes_ );
+        // Each well scales its contribution in the well space and adds it
+        // to the rows of its perforated cells only, so no full-length
+        // temporary or axpy is needed.
+        for (auto& well : well_container_) {
+            well->applyScaleAdd(alpha, x, Ax);
+        }
     }
 
 
@@ -33,6 +33,7 @@
 
 #include <cassert>
 #include <sstream>
+#include <utility>
 
 namespace Opm
 {
@@ -48,7 +49,7 @@ GasLiftSingleWellGeneric::GasLiftSingleWellGeneric(
     const int report_step_idx,
     GLiftSyncGroups &sync_groups
 ) :
-    deferred_logger_{deferred_logger}
+    deferred_logger_{&deferred_logger}
     , well_state_{well_state}
     , group_state_{group_state}
     , ecl_well_{ecl_well}
@@ -96,13 +97,9 @@ calcIncOrDecGradient(double oil_rate, double gas_rate, double alq, bool increase
     if (!new_alq_opt)
         return std::nullopt;
     double new_alq = *new_alq_opt;
-    if (auto bhp = computeBhpAtThpLimit_(new_alq)) {
-        auto new_bhp = getBhpWithLimit_(*bhp);
-        // TODO: What to do if BHP is limited?
-        std::vector<double> potentials(this->num_phases_, 0.0);
-        computeWellRates_(new_bhp.first, potentials);
-        auto [new_oil_rate, oil_is_limited] = getOilRateWithLimit_(potentials);
-        auto [new_gas_rate, gas_is_limited] = getGasRateWithLimit_(potentials);
+    if (auto potentials = computeWellRatesWithALQ_(new_alq)) {
+        auto [new_oil_rate, oil_is_limited] = getOilRateWithLimit_(*potentials);
+        auto [new_gas_rate, gas_is_limited] = getGasRateWithLimit_(*potentials);
         if (!increase && new_oil_rate < 0 ) {
             return std::nullopt;
         }
@@ -116,6 +113,24 @@ calcIncOrDecGradient(double oil_rate, double gas_rate, double alq, bool increase
     }
 }
 
+void
+GasLiftSingleWellGeneric::
+prepareIncOrDecGradient(double alq, bool increase, DeferredLogger& deferred_logger)
+{
+    auto new_alq_opt = addOrSubtractAlqIncrement_(alq, increase).first;
+    if (!new_alq_opt)
+        return;
+    DeferredLogger* well_logger = std::exchange(this->deferred_logger_, &deferred_logger);
+    try {
+        computeWellRatesWithALQ_(*new_alq_opt);
+    }
+    catch (...) {
+        this->deferred_logger_ = well_logger;
+        throw;
+    }
+    this->deferred_logger_ = well_logger;
+}
+
 std::unique_ptr<GasLiftWellState>
 GasLiftSingleWellGeneric::
 runOptimize(const int iteration_idx)
@@ -315,6 +330,25 @@ computeInitialWellRates_(std::vector<double>& potentials)
     }
 }
 
+std::optional<std::vector<double>>
+GasLiftSingleWellGeneric::
+computeWellRatesWithALQ_(double alq) const
+{
+    for (const auto& [cached_alq, potentials] : this->alq_rates_cache_) {
+        if (checkALQequal_(cached_alq, alq))
+            return potentials;
+    }
+    std::optional<std::vector<double>> potentials;
+    if (auto bhp = computeBhpAtThpLimit_(alq)) {
+        auto new_bhp = getBhpWithLimit_(*bhp);
+        // TODO: What to do if BHP is limited?
+        potentials.emplace(this->num_phases_, 0.0);
+        computeWellRates_(new_bhp.first, *potentials);
+    }
+    this->alq_rates_cache_.emplace_back(alq, potentials);
+    return potentials;
+}
+
 void
 GasLiftSingleWellGeneric::
 debugCheckNegativeGradient_(double grad, double alq, double new_alq, double oil_rate,
@@ -415,7 +449,7 @@ displayDebugMessage_(const std::string& msg) const
     if (this->debug_) {
         const std::string message = fmt::format(
             "  GLIFT (DEBUG) : Well {} : {}", this->well_name_, msg);
-        this->deferred_logger_.info(message);
+        this->deferred_logger_->info(message);
     }
 }
 
@@ -425,7 +459,7 @@ displayWarning_(const std::string& msg)
 {
     const std::string message = fmt::format(
         "GAS LIFT OPTIMIZATION, WELL {} : {}", this->well_name_, msg);
-    this->deferred_logger_.warning("WARNING", message);
+    this->deferred_logger_->warning("WARNING", message);
 }
 
 std::pair<double, bool>
@@ -602,7 +636,7 @@ logSuccess_(double alq, const int iteration_idx)
          this->well_name_,
          ((alq > this->orig_alq_) ? "increased" : "decreased"),
          this->orig_alq_, alq);
-    this->deferred_logger_.info(message);
+    this->deferred_logger_->info(message);
 }
 
 std::tuple<double,double,double,bool,bool>
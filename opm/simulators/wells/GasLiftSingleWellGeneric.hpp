@@ -87,6 +87,12 @@ public:
     std::optional<GradInfo> calcIncOrDecGradient(double oil_rate, double gas_rate,
                                                  double alq, bool increase) const;
 
+    // Compute the well rates that calcIncOrDecGradient() needs for the
+    // given alq and direction, and keep them for the actual call. Messages
+    // go to the given logger instead of the one of the well, so different
+    // wells can be prepared concurrently.
+    void prepareIncOrDecGradient(double alq, bool increase, DeferredLogger& deferred_logger);
+
     std::unique_ptr<GasLiftWellState> runOptimize(const int iteration_idx);
 
     virtual const WellInterfaceGeneric& getStdWell() const = 0;
@@ -161,6 +167,8 @@ protected:
 
     bool computeInitialWellRates_(std::vector<double>& potentials);
 
+    std::optional<std::vector<double>> computeWellRatesWithALQ_(double alq) const;
+
     void debugCheckNegativeGradient_(double grad, double alq, double new_alq,
                                      double oil_rate, double new_oil_rate, double gas_rate,
                                      double new_gas_rate, bool increase) const;
@@ -223,7 +231,7 @@ protected:
 
     void warnMaxIterationsExceeded_();
 
-    DeferredLogger& deferred_logger_;
+    DeferredLogger* deferred_logger_;
     WellState& well_state_;
     const GroupState& group_state_;
     const Well& ecl_well_;
@@ -257,6 +265,11 @@ protected:
     bool debug_limit_increase_decrease_;
     bool debug_abort_if_decrease_and_oil_is_limited_ = false;
     bool debug_abort_if_increase_and_gas_is_limited_ = false;
+
+    // Rates from computeWellRatesWithALQ_() for the ALQ values visited so
+    // far. The object only lives for one optimization, during which the
+    // rates only depend on the ALQ.
+    mutable std::vector<std::pair<double, std::optional<std::vector<double>>>> alq_rates_cache_;
 };
 
 } // namespace Opm
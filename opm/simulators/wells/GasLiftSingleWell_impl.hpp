@@ -104,7 +104,7 @@ computeWellRates_(
     //   the new potentials to the old values..
     std::fill(potentials.begin(), potentials.end(), 0.0);
     this->std_well_.computeWellRatesWithBhp(
-        this->ebos_simulator_, bhp, potentials, this->deferred_logger_);
+        this->ebos_simulator_, bhp, potentials, *this->deferred_logger_);
     if (debug_output) {
         const std::string msg = fmt::format("computed well potentials given bhp {}, "
             "oil: {}, gas: {}, water: {}", bhp,
@@ -122,7 +122,7 @@ computeBhpAtThpLimit_(double alq) const
     auto bhp_at_thp_limit = this->std_well_.computeBhpAtThpLimitProdWithAlq(
         this->ebos_simulator_,
         this->summary_state_,
-        this->deferred_logger_,
+        *this->deferred_logger_,
         alq);
     if (bhp_at_thp_limit) {
         if (*bhp_at_thp_limit < this->controls_.bhp_limit) {
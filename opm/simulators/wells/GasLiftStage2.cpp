@@ -24,14 +24,19 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 
 #include <opm/simulators/utils/DeferredLogger.hpp>
+#include <opm/simulators/utils/threadedForEach.hpp>
 #include <opm/simulators/wells/GasLiftSingleWellGeneric.hpp>
 #include <opm/simulators/wells/GasLiftWellState.hpp>
+#include <opm/simulators/wells/ParallelWellInfo.hpp>
 #include <opm/simulators/wells/WellInterfaceGeneric.hpp>
 #include <opm/simulators/wells/WellState.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -163,31 +168,14 @@ bool
 GasLiftStage2::
 checkRateAlreadyLimited_(GasLiftWellState &state, bool increase)
 {
-    auto current_increase = state.increase();
-    bool do_check = false;
-    if (current_increase) {
-        if (*current_increase == increase) do_check = true;
-    }
-    else {
-        // If current_increase is not defined, it means that stage1
-        //   was unable to either increase nor decrease the ALQ. If the
-        //   initial rates stored in "state" is limited, and if
-        //   "increase" is true, it is not likely that adding ALQ will
-        //   cause the new rates not to be limited. However, if
-        //   "increase" is false, subtracting ALQ can make the new rates
-        //   not limited.
-        if (increase) do_check = true;
-    }
-    if (do_check) {
-        if (state.gasIsLimited() || state.oilIsLimited() || state.alqIsLimited()) {
-            const std::string msg = fmt::format(
-                "{} gradient : skipping since {} was limited in previous step",
-                (increase ? "incremental" : "decremental"),
-                (state.oilIsLimited() ? "oil" :
-                    (state.gasIsLimited() ? "gas" : "alq")));
-            displayDebugMessage_(msg);
-            return true;
-        }
+    if (isRateAlreadyLimited_(state, increase)) {
+        const std::string msg = fmt::format(
+            "{} gradient : skipping since {} was limited in previous step",
+            (increase ? "incremental" : "decremental"),
+            (state.oilIsLimited() ? "oil" :
+                (state.gasIsLimited() ? "gas" : "alq")));
+        displayDebugMessage_(msg);
+        return true;
     }
     return false;
 }
@@ -449,6 +437,29 @@ getGroupGliftWellsRecursive_(const Group &group,
     }
 }
 
+bool
+GasLiftStage2::
+isRateAlreadyLimited_(const GasLiftWellState &state, bool increase)
+{
+    auto current_increase = state.increase();
+    bool do_check = false;
+    if (current_increase) {
+        if (*current_increase == increase) do_check = true;
+    }
+    else {
+        // If current_increase is not defined, it means that stage1
+        //   was unable to either increase nor decrease the ALQ. If the
+        //   initial rates stored in "state" is limited, and if
+        //   "increase" is true, it is not likely that adding ALQ will
+        //   cause the new rates not to be limited. However, if
+        //   "increase" is false, subtracting ALQ can make the new rates
+        //   not limited.
+        if (increase) do_check = true;
+    }
+    return do_check
+        && (state.gasIsLimited() || state.oilIsLimited() || state.alqIsLimited());
+}
+
 void
 GasLiftStage2::
 mpiSyncGlobalGradVector_(std::vector<GradPair> &grads_global) const
@@ -550,6 +561,45 @@ optimizeGroupsRecursive_(const Group &group)
 
 }
 
+// prepareIncOrDecGrads_() :
+//
+// Each gradient needs a bhp from thp limit solve and a rate computation
+// for the well at the new ALQ. These are independent between wells, so
+// they are done here concurrently for all the requested (well, direction)
+// pairs, and the following calls to calcIncOrDecGrad_() find the rates in
+// the cache of the well. A well is handled by a single thread, and
+// distributed wells are skipped since their rate computations communicate.
+void
+GasLiftStage2::
+prepareIncOrDecGrads_(const std::vector<std::pair<GasLiftSingleWell *, bool>> &grads)
+{
+    std::vector<GasLiftSingleWell *> wells;
+    std::vector<std::vector<bool>> directions;
+    for (const auto& [well, increase] : grads) {
+        const auto &name = well->name();
+        if (this->well_state_map_.count(name) == 0)
+            continue;
+        if (well->getStdWell().parallelWellInfo().communication().size() > 1)
+            continue;
+        if (isRateAlreadyLimited_(*(this->well_state_map_.at(name)), increase))
+            continue;
+        auto it = std::find(wells.begin(), wells.end(), well);
+        if (it == wells.end()) {
+            wells.push_back(well);
+            directions.emplace_back();
+            it = wells.end() - 1;
+        }
+        directions[it - wells.begin()].push_back(increase);
+    }
+
+    threadedForEach(wells.size(), [&](const int w, DeferredLogger& logger) {
+        const double alq = this->well_state_map_.at(wells[w]->name())->alq();
+        for (const bool increase : directions[w]) {
+            wells[w]->prepareIncOrDecGradient(alq, increase, logger);
+        }
+    }, this->deferred_logger_);
+}
+
 void
 GasLiftStage2::
 recalculateGradientAndUpdateData_(
@@ -856,6 +906,13 @@ GasLiftStage2::OptimizeState::
 calculateEcoGradients(std::vector<GasLiftSingleWell *> &wells,
            std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_grads)
 {
+    std::vector<std::pair<GasLiftSingleWell *, bool>> grads;
+    for (auto well_ptr : wells) {
+        grads.emplace_back(well_ptr, /*increase=*/true);
+        grads.emplace_back(well_ptr, /*increase=*/false);
+    }
+    this->parent.prepareIncOrDecGrads_(grads);
+
     for (auto well_ptr : wells) {
         const auto &gs_well = *well_ptr;  // gs = GasLiftSingleWell
         const auto &name = gs_well.name();
@@ -950,6 +1007,14 @@ recalculateGradients(
          std::vector<GradPair> &inc_grads, std::vector<GradPair> &dec_grads,
          GradPairItr &min_dec_grad_itr, GradPairItr &max_inc_grad_itr)
 {
+    std::vector<std::pair<GasLiftSingleWell *, bool>> grads;
+    for (const auto& [name, increase] : {std::make_pair(max_inc_grad_itr->first, true),
+                                         std::make_pair(min_dec_grad_itr->first, false)}) {
+        if (this->parent.stage1_wells_.count(name) > 0)
+            grads.emplace_back(this->parent.stage1_wells_.at(name).get(), increase);
+    }
+    this->parent.prepareIncOrDecGrads_(grads);
+
     this->parent.recalculateGradientAndUpdateData_(
         max_inc_grad_itr, /*increase=*/true, inc_grads, dec_grads);
     this->parent.recalculateGradientAndUpdateData_(
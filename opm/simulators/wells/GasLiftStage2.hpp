@@ -32,6 +32,7 @@
 #include <optional>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace Opm
@@ -82,6 +83,7 @@ private:
     std::optional<GradInfo> calcIncOrDecGrad_(
         const std::string name, const GasLiftSingleWell& gs_well, bool increase);
     bool checkRateAlreadyLimited_(GasLiftWellState& state, bool increase);
+    static bool isRateAlreadyLimited_(const GasLiftWellState& state, bool increase);
     GradInfo deleteDecGradItem_(const std::string& name);
     GradInfo deleteIncGradItem_(const std::string& name);
     GradInfo deleteGrad_(const std::string& name, bool increase);
@@ -102,6 +104,8 @@ private:
         const Group& group, std::vector<GasLiftSingleWell *>& wells);
     std::pair<double, double> getStdWellRates_(const WellInterfaceGeneric& well);
     void optimizeGroup_(const Group& group);
+    void prepareIncOrDecGrads_(
+        const std::vector<std::pair<GasLiftSingleWell *, bool>>& grads);
     void optimizeGroupsRecursive_(const Group& group);
     void recalculateGradientAndUpdateData_(
         GradPairItr& grad_itr, bool increase,
@@ -0,0 +1,145 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/simulators/wells/GroupTree.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Group/Group.hpp>
+#include <opm/simulators/wells/WellPhaseContainer.hpp>
+#include <opm/simulators/wells/WellState.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Opm {
+
+GroupTree::GroupTree(const Schedule& schedule, int report_step)
+    : report_step_(report_step)
+{
+    this->addGroup(schedule, "FIELD", -1);
+}
+
+void GroupTree::addGroup(const Schedule& schedule, const std::string& gname, int parent_id)
+{
+    const auto& group = schedule.getGroup(gname, this->report_step_);
+    const int group_id = this->group_names_.size();
+    this->group_names_.push_back(gname);
+    this->group_parent_.push_back(parent_id);
+    this->group_efficiency_.push_back(group.getGroupEfficiencyFactor());
+    this->group_index_.emplace(gname, group_id);
+
+    for (const auto& child : group.groups())
+        this->addGroup(schedule, child, group_id);
+
+    for (const auto& wname : group.wells()) {
+        const auto& well = schedule.getWell(wname, this->report_step_);
+        this->well_index_.emplace(wname, this->wells_.size());
+        this->wells_.push_back({wname,
+                                group_id,
+                                well.getEfficiencyFactor(),
+                                well.isProducer(),
+                                well.isInjector(),
+                                well.getStatus() == Well::Status::SHUT});
+    }
+
+    // Post order, i.e. after all the subgroups.
+    this->bottom_up_order_.push_back(group_id);
+}
+
+int GroupTree::groupId(const std::string& gname) const
+{
+    auto it = this->group_index_.find(gname);
+    return it == this->group_index_.end() ? -1 : it->second;
+}
+
+std::vector<std::string> GroupTree::chainTopBot(const std::string& bottom, const std::string& top) const
+{
+    int parent_id;
+    auto well_it = this->well_index_.find(bottom);
+    if (well_it != this->well_index_.end())
+        parent_id = this->wells_[well_it->second].group_id;
+    else {
+        const int group_id = this->groupId(bottom);
+        if (group_id < 0)
+            OPM_THROW(std::logic_error, "No well or group " << bottom << " in the group tree");
+        parent_id = this->parent(group_id);
+    }
+
+    std::vector<std::string> chain{bottom};
+    while (parent_id >= 0) {
+        chain.push_back(this->group_names_[parent_id]);
+        if (chain.back() == top) {
+            std::reverse(chain.begin(), chain.end());
+            return chain;
+        }
+        parent_id = this->parent(parent_id);
+    }
+    OPM_THROW(std::logic_error, "Group " << top << " is not above " << bottom << " in the group tree");
+}
+
+std::vector<double> GroupTree::sumWellPhaseRates(const WellPhaseContainer<double>& rates,
+                                                 const WellState& well_state,
+                                                 bool injector) const
+{
+    const std::size_t np = rates.num_phases();
+    std::vector<double> sums(this->numGroups() * np, 0.0);
+
+    const auto& well_map = well_state.wellMap();
+    for (const auto& well : this->wells_) {
+        // only count producers or injectors
+        if ((well.is_producer && injector) || (well.is_injector && !injector))
+            continue;
+
+        if (well.is_shut)
+            continue;
+
+        auto it = well_map.find(well.name);
+        if (it == well_map.end()) // the well is not on this process
+            continue;
+
+        const int well_index = it->second[0];
+        if (!well_state.wellIsOwned(well_index, well.name)) // Only sum once
+            continue;
+
+        const double factor = injector ? well.efficiency_factor : -well.efficiency_factor;
+        const auto& well_rates = rates[well_index];
+        auto* group_sums = &sums[well.group_id * np];
+        for (std::size_t p = 0; p < np; ++p)
+            group_sums[p] += factor * well_rates[p];
+    }
+
+    for (const int group_id : this->bottom_up_order_) {
+        auto* group_sums = &sums[group_id * np];
+        const double gefac = this->group_efficiency_[group_id];
+        for (std::size_t p = 0; p < np; ++p)
+            group_sums[p] *= gefac;
+
+        const int parent_id = this->parent(group_id);
+        if (parent_id >= 0) {
+            auto* parent_sums = &sums[parent_id * np];
+            for (std::size_t p = 0; p < np; ++p)
+                parent_sums[p] += group_sums[p];
+        }
+    }
+    return sums;
+}
+
+}
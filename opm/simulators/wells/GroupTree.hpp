@@ -0,0 +1,108 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GROUPTREE_HEADER_INCLUDED
+#define OPM_GROUPTREE_HEADER_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+class Schedule;
+class WellState;
+
+template <typename>
+class WellPhaseContainer;
+
+/*
+  The GroupTree class is a compiled version of the group tree below FIELD at
+  one report step. Groups and wells get integer ids, the parent of each group
+  is stored in an array and the groups are ordered so that all the subgroups
+  of a group come before the group itself. With this a sum over the wells of
+  every group in the tree is one pass over the wells followed by one pass
+  over the groups, and the chain from a well or group up to one of its
+  ancestors is a walk in the parent array.
+
+  The tree only depends on the schedule, so it must be rebuilt when the
+  report step changes or the schedule is updated by an ACTIONX.
+*/
+
+class GroupTree {
+public:
+    GroupTree(const Schedule& schedule, int report_step);
+
+    int reportStep() const { return this->report_step_; }
+
+    std::size_t numGroups() const { return this->group_names_.size(); }
+
+    const std::string& groupName(int group_id) const { return this->group_names_[group_id]; }
+
+    /// Id of the group with name @gname, or -1 if it is not in the tree.
+    int groupId(const std::string& gname) const;
+
+    /// Id of the parent of a group, -1 for FIELD.
+    int parent(int group_id) const { return this->group_parent_[group_id]; }
+
+    /// All group ids, every group after all its subgroups.
+    const std::vector<int>& bottomUpOrder() const { return this->bottom_up_order_; }
+
+    /// Same as WellGroupHelpers::groupChainTopBot() : the names from @top
+    /// down to @bottom, where @bottom is a well or a group below @top.
+    std::vector<std::string> chainTopBot(const std::string& bottom, const std::string& top) const;
+
+    /*
+      Efficiency scaled sum of the phase rates @rates of the producers
+      (injector == false) or injectors of every group, in a flat array with
+      the value for group g and phase p at g * num_phases + p. The same
+      wells are counted as in WellGroupHelpers::sumWellPhaseRates(), i.e.
+      open wells owned by this process, and production rates are summed
+      with positive sign.
+    */
+    std::vector<double> sumWellPhaseRates(const WellPhaseContainer<double>& rates,
+                                          const WellState& well_state,
+                                          bool injector) const;
+
+private:
+    struct WellNode {
+        std::string name;
+        int group_id;
+        double efficiency_factor;
+        bool is_producer;
+        bool is_injector;
+        bool is_shut;
+    };
+
+    void addGroup(const Schedule& schedule, const std::string& gname, int parent_id);
+
+    int report_step_;
+    std::vector<std::string> group_names_;
+    std::vector<int> group_parent_;
+    std::vector<double> group_efficiency_;
+    std::vector<int> bottom_up_order_;
+    std::unordered_map<std::string, int> group_index_;
+    std::vector<WellNode> wells_;
+    std::unordered_map<std::string, int> well_index_;
+};
+
+}
+
+#endif
@@ -28,6 +28,8 @@
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/MSW/SICD.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/simulators/wells/SegmentTreeSolver.hpp>
+#include <memory>
 #include <string>
 #include<dune/istl/matrix.hh>
 #include <dune/istl/preconditioners.hh>
@@ -123,6 +125,73 @@ namespace mswellhelpers
 
 
 
+    /// Solves D y = x with a block LU factorization along the segment tree,
+    /// factorizing D if the solver is not set, and checks for singularity
+    template <typename MatrixType, typename VectorType>
+    VectorType
+    applySegmentTreeSolver(const MatrixType& D,
+                           const std::shared_ptr<const SegmentTree>& tree,
+                           std::shared_ptr<SegmentTreeSolver<MatrixType> >& linsolver,
+                           const VectorType& x)
+    {
+        if (!linsolver)
+        {
+            linsolver = std::make_shared<SegmentTreeSolver<MatrixType> >(tree, D);
+        }
+
+        VectorType y(x.size());
+        linsolver->apply(y, x);
+
+        // Checking if there is any inf or nan in y, which a nearly singular
+        // matrix may give without being caught by the factorization
+        for (size_t i_block = 0; i_block < y.size(); ++i_block) {
+            for (size_t i_elem = 0; i_elem < y[i_block].size(); ++i_elem) {
+                if (std::isinf(y[i_block][i_elem]) || std::isnan(y[i_block][i_elem]) ) {
+                    const std::string msg{"nan or inf value found after segment matrix solve due to singular matrix"};
+                    OpmLog::debug(msg);
+                    OPM_THROW_NOLOG(NumericalIssue, msg);
+                }
+            }
+        }
+        return y;
+    }
+
+
+
+    /// Computes the full block inverse of D with the segment tree solver
+    template <typename MatrixType, typename VectorType>
+    Dune::Matrix<typename MatrixType::block_type>
+    invertWithSegmentTreeSolver(const MatrixType& D,
+                                const std::shared_ptr<const SegmentTree>& tree,
+                                std::shared_ptr<SegmentTreeSolver<MatrixType> >& linsolver)
+    {
+        const int sz = D.M();
+        const int bsz = D[0][0].M();
+        VectorType e(sz);
+        e = 0.0;
+
+        // Make a full block matrix.
+        Dune::Matrix<typename MatrixType::block_type> inv(sz, sz);
+
+        // Create inverse by passing basis vectors to the solver.
+        for (int ii = 0; ii < sz; ++ii) {
+            for (int jj = 0; jj < bsz; ++jj) {
+                e[ii][jj] = 1.0;
+                auto col = applySegmentTreeSolver(D, tree, linsolver, e);
+                for (int cc = 0; cc < sz; ++cc) {
+                    for (int dd = 0; dd < bsz; ++dd) {
+                        inv[cc][ii][dd][jj] = col[cc][dd];
+                    }
+                }
+                e[ii][jj] = 0.0;
+            }
+        }
+
+        return inv;
+    }
+
+
+
     // obtain y = D^-1 * x with a BICSSTAB iterative solver
     template <typename MatrixType, typename VectorType>
     VectorType
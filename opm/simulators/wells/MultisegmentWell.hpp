@@ -131,6 +131,8 @@ namespace Opm
 
         /// Ax = Ax - C D^-1 B x
         virtual void apply(const BVector& x, BVector& Ax) const override;
+        /// Ax = Ax - alpha C D^-1 B x
+        virtual void applyScaleAdd(const Scalar alpha, const BVector& x, BVector& Ax) const override;
         /// r = r - C D^-1 Rw
         virtual void apply(BVector& r) const override;
 
@@ -102,6 +102,11 @@ initMatrixAndVectors(const int num_cells) const
         }
     }
 
+    // the pattern of duneD_ is fixed from here on, so the elimination order
+    // of the segments is computed once for all factorizations
+    duneDTree_ = std::make_shared<const mswellhelpers::SegmentTree>(duneD_);
+    duneDSolver_.reset();
+
     // make the C matrix
     for (auto row = duneC_.createbegin(), end = duneC_.createend(); row != end; ++row) {
         // the number of the row corresponds to the segment number now.
@@ -514,7 +519,7 @@ recoverSolutionWell(const BVector& x, BVectorWell& xw) const
     // resWell = resWell - B * x
     duneB_.mmv(x, resWell);
     // xw = D^-1 * resWell
-    xw = mswellhelpers::applyUMFPack(duneD_, duneDSolver_, resWell);
+    xw = mswellhelpers::applySegmentTreeSolver(duneD_, duneDTree_, duneDSolver_, resWell);
 }
 
 template<typename FluidSystem, typename Indices, typename Scalar>
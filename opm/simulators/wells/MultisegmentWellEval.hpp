@@ -23,6 +23,7 @@
 #define OPM_MULTISEGMENTWELL_EVAL_HEADER_INCLUDED
 
 #include <opm/simulators/wells/MultisegmentWellGeneric.hpp>
+#include <opm/simulators/wells/SegmentTreeSolver.hpp>
 
 #include <opm/material/densead/Evaluation.hpp>
 
@@ -274,10 +275,13 @@ protected:
     // "diagonal" matrix for the well. It has offdiagonal entries for inlets and outlets.
     mutable DiagMatWell duneD_;
 
+    /// \brief elimination order of the segments, from the sparsity pattern of duneD_
+    mutable std::shared_ptr<const mswellhelpers::SegmentTree> duneDTree_;
+
     /// \brief solver for diagonal matrix
     ///
     /// This is a shared_ptr as MultisegmentWell is copied in computeWellPotentials...
-    mutable std::shared_ptr<Dune::UMFPack<DiagMatWell> > duneDSolver_;
+    mutable std::shared_ptr<mswellhelpers::SegmentTreeSolver<DiagMatWell> > duneDSolver_;
 
     // residuals of the well equations
     mutable BVectorWell resWell_;
@@ -467,10 +467,11 @@ computeBhpAtThpLimitProd(const std::function<std::vector<double>(const double)>&
     const double vfp_ref_depth = table.getDatumDepth();
     const double thp_limit = baseif_.getTHPConstraint(summary_state);
     const double dp = wellhelpers::computeHydrostaticCorrection(baseif_.refDepth(), vfp_ref_depth, rho, baseif_.gravity());
-    auto fbhp = [this, &controls, thp_limit, dp](const std::vector<double>& rates) {
+    detail::VFPInterpCache vfp_cache;
+    auto fbhp = [this, &controls, thp_limit, dp, &vfp_cache](const std::vector<double>& rates) {
         assert(rates.size() == 3);
         return baseif_.vfpProperties()->getProd()
-        ->bhp(controls.vfp_table_number, rates[Water], rates[Oil], rates[Gas], thp_limit, controls.alq_value) - dp;
+        ->bhp(controls.vfp_table_number, rates[Water], rates[Oil], rates[Gas], thp_limit, controls.alq_value, vfp_cache) - dp;
     };
 
     // Make the flo() function.
@@ -195,7 +195,35 @@ namespace Opm
         this->duneB_.mv(x, Bx);
 
         // invDBx = duneD^-1 * Bx_
-        const BVectorWell invDBx = mswellhelpers::applyUMFPack(this->duneD_, this->duneDSolver_, Bx);
+        const BVectorWell invDBx = mswellhelpers::applySegmentTreeSolver(this->duneD_, this->duneDTree_, this->duneDSolver_, Bx);
+
+        // Ax = Ax - duneC_^T * invDBx
+        this->duneC_.mmtv(invDBx,Ax);
+    }
+
+
+
+
+
+    template <typename TypeTag>
+    void
+    MultisegmentWell<TypeTag>::
+    applyScaleAdd(const Scalar alpha, const BVector& x, BVector& Ax) const
+    {
+        if (!this->isOperable() && !this->wellIsStopped()) return;
+
+        if ( param_.matrix_add_well_contributions_ )
+        {
+            // Contributions are already in the matrix itself
+            return;
+        }
+        BVectorWell Bx(this->duneB_.N());
+
+        this->duneB_.mv(x, Bx);
+
+        // invDBx = alpha * duneD^-1 * Bx_
+        BVectorWell invDBx = mswellhelpers::applySegmentTreeSolver(this->duneD_, this->duneDTree_, this->duneDSolver_, Bx);
+        invDBx *= alpha;
 
         // Ax = Ax - duneC_^T * invDBx
         this->duneC_.mmtv(invDBx,Ax);
@@ -213,7 +241,7 @@ namespace Opm
         if (!this->isOperable() && !this->wellIsStopped()) return;
 
         // invDrw_ = duneD^-1 * resWell_
-        const BVectorWell invDrw = mswellhelpers::applyUMFPack(this->duneD_, this->duneDSolver_, this->resWell_);
+        const BVectorWell invDrw = mswellhelpers::applySegmentTreeSolver(this->duneD_, this->duneDTree_, this->duneDSolver_, this->resWell_);
         // r = r - duneC_^T * invDrw
         this->duneC_.mmtv(invDrw, r);
     }
@@ -446,7 +474,7 @@ namespace Opm
 
         // We assemble the well equations, then we check the convergence,
         // which is why we do not put the assembleWellEq here.
-        const BVectorWell dx_well = mswellhelpers::applyUMFPack(this->duneD_, this->duneDSolver_, this->resWell_);
+        const BVectorWell dx_well = mswellhelpers::applySegmentTreeSolver(this->duneD_, this->duneDTree_, this->duneDSolver_, this->resWell_);
 
         updateWellState(dx_well, well_state, deferred_logger);
     }
@@ -646,7 +674,7 @@ namespace Opm
     MultisegmentWell<TypeTag>::
     addWellContributions(SparseMatrixAdapter& jacobian) const
     {
-        const auto invDuneD = mswellhelpers::invertWithUMFPack<DiagMatWell, BVectorWell>(this->duneD_, this->duneDSolver_);
+        const auto invDuneD = mswellhelpers::invertWithSegmentTreeSolver<DiagMatWell, BVectorWell>(this->duneD_, this->duneDTree_, this->duneDSolver_);
 
         // We need to change matrix A as follows
         // A -= C^T D^-1 B
@@ -1049,7 +1077,6 @@ namespace Opm
         if (!this->isOperable() && !this->wellIsStopped()) return true;
 
         const int max_iter_number = param_.max_inner_iter_ms_wells_;
-        const WellState well_state0 = well_state;
         const std::vector<Scalar> residuals0 = this->getWellResiduals(Base::B_avg_, deferred_logger);
         std::vector<std::vector<Scalar> > residual_history;
         std::vector<double> measure_history;
@@ -1064,7 +1091,7 @@ namespace Opm
 
             assembleWellEqWithoutIteration(ebosSimulator, dt, inj_controls, prod_controls, well_state, group_state, deferred_logger);
 
-            const BVectorWell dx_well = mswellhelpers::applyUMFPack(this->duneD_, this->duneDSolver_, this->resWell_);
+            const BVectorWell dx_well = mswellhelpers::applySegmentTreeSolver(this->duneD_, this->duneDTree_, this->duneDSolver_, this->resWell_);
 
             if (it > param_.strict_inner_iter_ms_wells_)
                 relax_convergence = true;
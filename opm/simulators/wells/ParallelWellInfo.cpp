@@ -22,6 +22,10 @@
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/Well.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
 namespace Dune
 {
 #if HAVE_MPI
@@ -195,6 +199,11 @@ void CommunicateAboveBelow::clear()
     current_indices_ = {};
     interface_.free();
     communicator_.free();
+    owner_local_indices_.clear();
+    perf_sizes_.clear();
+    perf_displ_.clear();
+    sorted_received_.clear();
+    local_sorted_position_.clear();
 #endif
     num_local_perfs_ = 0;
 }
@@ -225,11 +234,59 @@ int CommunicateAboveBelow::endReset()
         using ToSet = Dune::AllSet<Attribute>;
         interface_.build(remote_indices_, FromSet(), ToSet());
         communicator_.build<double*>(interface_);
+        setupPartialSum();
     }
 #endif
     return num_local_perfs_;
 }
 
+#if HAVE_MPI
+void CommunicateAboveBelow::setupPartialSum()
+{
+    // The global index used in the index set current_indices
+    // is the index of the perforation in ECL Schedule definition.
+    // This is assumed to give the topological order that is used
+    // when doing the partial sum. The owned perforations do not change
+    // until the next reset, hence we allgather their ECL indices and sort
+    // them once here, and partialSumPerfValues only needs to allgather
+    // the values.
+    using GlobalIndex = typename IndexSet::IndexPair::GlobalIndex;
+    std::vector<GlobalIndex> my_indices;
+    for (const auto& pair: current_indices_)
+    {
+        if (pair.local().attribute() == owner)
+        {
+            my_indices.push_back(pair.global());
+            owner_local_indices_.push_back(pair.local().local());
+        }
+    }
+    perf_sizes_.resize(comm_.size());
+    perf_displ_.resize(comm_.size() + 1, 0);
+    int mySize = my_indices.size();
+    comm_.allgather(&mySize, 1, perf_sizes_.data());
+    std::partial_sum(perf_sizes_.begin(), perf_sizes_.end(), perf_displ_.begin()+1);
+    std::vector<GlobalIndex> global_indices(perf_displ_.back());
+    comm_.allgatherv(my_indices.data(), my_indices.size(), global_indices.data(),
+                     perf_sizes_.data(), perf_displ_.data());
+
+    sorted_received_.resize(global_indices.size());
+    std::iota(sorted_received_.begin(), sorted_received_.end(), 0);
+    std::sort(sorted_received_.begin(), sorted_received_.end(),
+              [&global_indices](int i, int j){ return global_indices[i] < global_indices[j]; });
+
+    local_sorted_position_.resize(num_local_perfs_);
+    for (const auto& pair: current_indices_)
+    {
+        auto sorted = std::lower_bound(sorted_received_.begin(), sorted_received_.end(),
+                                       pair.global(),
+                                       [&global_indices](int i, const GlobalIndex& index)
+                                       { return global_indices[i] < index; });
+        assert(sorted != sorted_received_.end());
+        assert(global_indices[*sorted] == pair.global());
+        local_sorted_position_[pair.local().local()] = sorted - sorted_received_.begin();
+    }
+}
+
 struct CopyGatherScatter
 {
     static const double& gather(const double* a, std::size_t i)
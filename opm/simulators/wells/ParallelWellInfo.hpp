@@ -81,7 +81,8 @@ public:
     /// \brief Indicates that the index information is complete.
     ///
     /// Sets up the commmunication structures to be used by
-    /// communicate()
+    /// communicate() and the sizes and ordering used by
+    /// partialSumPerfValues().
     /// \return The number of local perforations
     int endReset();
 
@@ -106,6 +107,8 @@ public:
     /// \brief Do a (in place) partial sum on values attached to all perforations.
     ///
     /// For distributed wells this may include perforations stored elsewhere.
+    /// Then this is one allgatherv of the values on the communicator of
+    /// this well.
     /// The result is stored in ther range given as the parameters
     /// \param begin The start of the range
     /// \param ebd The end of the range
@@ -120,48 +123,28 @@ public:
         else
         {
 #if HAVE_MPI
-            // The global index used in the index set current_indices
-            // is the index of the perforation in ECL Schedule definition.
-            // This is assumed to give the topological order that is used
-            // when doing the partial sum.
-            // allgather the index of the perforation in ECL schedule and the value.
+            // The perforations owned by each rank and their order in the
+            // ECL schedule have been exchanged in endReset(). Here only the
+            // values are gathered, put in the topological order given by
+            // the ECL index, summed and the local ones copied back.
             using Value = typename std::iterator_traits<RAIterator>::value_type;
-            std::vector<int> sizes(comm_.size());
-            std::vector<int> displ(comm_.size() + 1, 0);
-            using GlobalIndex = typename IndexSet::IndexPair::GlobalIndex;
-            using Pair = std::pair<GlobalIndex,Value>;
-            std::vector<Pair> my_pairs;
-            my_pairs.reserve(current_indices_.size());
-            for (const auto& pair: current_indices_)
+            std::vector<Value> my_values;
+            my_values.reserve(owner_local_indices_.size());
+            for (const auto local : owner_local_indices_)
             {
-                if (pair.local().attribute() == owner)
-                {
-                    my_pairs.emplace_back(pair.global(), begin[pair.local()]);
-                }
+                my_values.push_back(begin[local]);
             }
-            int mySize = my_pairs.size();
-            comm_.allgather(&mySize, 1, sizes.data());
-            std::partial_sum(sizes.begin(), sizes.end(), displ.begin()+1);
-            std::vector<Pair> global_pairs(displ.back());
-            comm_.allgatherv(my_pairs.data(), my_pairs.size(), global_pairs.data(), sizes.data(), displ.data());
-            // sort the complete range to get the correct ordering
-            std::sort(global_pairs.begin(), global_pairs.end(),
-                      [](const Pair& p1, const Pair& p2){ return p1.first < p2.first; } );
-            std::vector<Value> sums(global_pairs.size());
-            std::transform(global_pairs.begin(), global_pairs.end(), sums.begin(),
-                           [](const Pair& p) { return p.second; });
+            std::vector<Value> received(perf_displ_.back());
+            comm_.allgatherv(my_values.data(), my_values.size(), received.data(),
+                             const_cast<int*>(perf_sizes_.data()),
+                             const_cast<int*>(perf_displ_.data()));
+            std::vector<Value> sums(received.size());
+            std::transform(sorted_received_.begin(), sorted_received_.end(), sums.begin(),
+                           [&received](int i) { return received[i]; });
             std::partial_sum(sums.begin(), sums.end(),sums.begin());
-            // assign the values (both ranges are sorted by the ecl index)
-            auto global_pair = global_pairs.begin();
-            for (const auto& pair: current_indices_)
+            for (std::size_t local = 0; local < local_sorted_position_.size(); ++local)
             {
-                global_pair = std::lower_bound(global_pair, global_pairs.end(),
-                                               pair.global(),
-                                               [](const Pair& val1, const GlobalIndex& val2)
-                                               { return val1.first < val2; });
-                assert(global_pair != global_pairs.end());
-                assert(global_pair->first == pair.global());
-                begin[pair.local()] = sums[global_pair - global_pairs.begin()];
+                begin[local] = sums[local_sorted_position_[local]];
             }
 #else
             OPM_THROW(std::logic_error, "In a sequential run the size of the communicator should be 1!");
@@ -174,6 +157,11 @@ public:
 
     int numLocalPerfs() const;
 private:
+#if HAVE_MPI
+    /// \brief Sets up the exchange used by partialSumPerfValues.
+    void setupPartialSum();
+#endif
+
     Communication comm_;
     /// \brief Mapping of the local well index to ecl index
     IndexSet current_indices_;
@@ -183,6 +171,18 @@ private:
     RI remote_indices_;
     Dune::Interface interface_;
     Dune::BufferedCommunicator communicator_;
+    /// \brief Local indices of the owned perforations, in the order they
+    ///        are sent in partialSumPerfValues
+    std::vector<std::size_t> owner_local_indices_;
+    /// \brief Number of owned perforations per rank for allgatherv
+    std::vector<int> perf_sizes_;
+    /// \brief displacement for allgatherv
+    std::vector<int> perf_displ_;
+    /// \brief Position in the gathered values for each perforation of the
+    ///        well, ordered by ECL index
+    std::vector<int> sorted_received_;
+    /// \brief Position in ECL order for each local perforation
+    std::vector<int> local_sorted_position_;
 #endif
     std::size_t num_local_perfs_{};
 };
@@ -372,6 +372,8 @@ public:
     /// \brief Do a (in place) partial sum on values attached to all perforations.
     ///
     /// For distributed wells this may include perforations stored elsewhere.
+    /// Then this is one allgatherv of the values on the communicator of
+    /// this well.
     /// The result is stored in ther range given as the parameters
     /// \param begin The start of the range
     /// \param ebd The end of the range
@@ -0,0 +1,186 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_SEGMENTTREESOLVER_HEADER_INCLUDED
+#define OPM_SEGMENTTREESOLVER_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/Exceptions.hpp>
+
+#include <dune/common/fmatrix.hh>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+namespace mswellhelpers
+{
+
+    /// The elimination order of the segments of a multisegment well.
+    ///
+    /// The segment matrix D of a multisegment well only couples a segment
+    /// with its outlet and its inlets, so its graph is a tree rooted at the
+    /// top segment (block tridiagonal for a plain tubing without branches).
+    /// Eliminating the segments leaves first creates no fill-in. This class
+    /// holds that order. It only depends on the sparsity pattern of D, so it
+    /// is computed once and shared by all later factorizations.
+    class SegmentTree
+    {
+    public:
+        /// Analyse the sparsity pattern of D. Segment 0 is the top segment.
+        template <typename MatrixType>
+        explicit SegmentTree(const MatrixType& D)
+            : parent_(D.N(), -1)
+        {
+            const std::size_t n = D.N();
+            if (n == 0) {
+                return;
+            }
+            // Breadth first search from the top segment. Reversing the
+            // visiting order gives an order with all inlets before their outlet.
+            std::vector<bool> visited(n, false);
+            order_.reserve(n);
+            order_.push_back(0);
+            visited[0] = true;
+            std::size_t edges = 0;
+            for (std::size_t k = 0; k < order_.size(); ++k) {
+                const int seg = order_[k];
+                for (auto col = D[seg].begin(); col != D[seg].end(); ++col) {
+                    const int other = col.index();
+                    if (other == seg) {
+                        continue;
+                    }
+                    ++edges;
+                    if (!visited[other]) {
+                        visited[other] = true;
+                        parent_[other] = seg;
+                        order_.push_back(other);
+                    }
+                }
+            }
+            // A tree with n nodes has n - 1 edges, each seen from both ends.
+            if (order_.size() != n || edges != 2 * (n - 1)) {
+                OPM_THROW(std::logic_error, "The segment matrix of a multisegment well must have the sparsity pattern of a tree");
+            }
+            order_.assign(order_.rbegin(), order_.rend());
+        }
+
+        /// Segments ordered with every inlet before its outlet.
+        const std::vector<int>& order() const
+        {
+            return order_;
+        }
+
+        /// The outlet of each segment, -1 for the top segment.
+        const std::vector<int>& parent() const
+        {
+            return parent_;
+        }
+
+    private:
+        std::vector<int> order_;
+        std::vector<int> parent_;
+    };
+
+
+
+    /// Block LU factorization of the segment matrix D of a multisegment
+    /// well, eliminating along a SegmentTree. Only the blocks on the
+    /// diagonal are inverted (with partial pivoting), so the cost is linear
+    /// in the number of segments and no general sparse direct solver is
+    /// needed.
+    template <typename MatrixType>
+    class SegmentTreeSolver
+    {
+    public:
+        using Block = typename MatrixType::block_type;
+
+        /// Factorize D, which must have the pattern the tree was built from.
+        SegmentTreeSolver(std::shared_ptr<const SegmentTree> tree, const MatrixType& D)
+            : tree_(std::move(tree))
+            , invS_(D.N())
+            , lower_(D.N())
+            , upper_(D.N())
+        {
+            const auto& parent = tree_->parent();
+            std::vector<Block> S(D.N());
+            for (std::size_t seg = 0; seg < D.N(); ++seg) {
+                S[seg] = D[seg][seg];
+            }
+            for (const int seg : tree_->order()) {
+                invS_[seg] = S[seg];
+                try {
+                    invS_[seg].invert();
+                }
+                catch (const Dune::FMatrixError&) {
+                    OPM_THROW_NOLOG(NumericalIssue, "Singular block found when factorizing the segment matrix of a multisegment well");
+                }
+                const int outlet = parent[seg];
+                if (outlet >= 0) {
+                    // S_outlet -= D(outlet, seg) S_seg^-1 D(seg, outlet)
+                    upper_[seg] = D[seg][outlet];
+                    lower_[seg] = D[outlet][seg];
+                    lower_[seg].rightmultiply(invS_[seg]);
+                    Block tmp = lower_[seg];
+                    tmp.rightmultiply(upper_[seg]);
+                    S[outlet] -= tmp;
+                }
+            }
+        }
+
+        /// Solve D x = b.
+        template <typename VectorType>
+        void apply(VectorType& x, const VectorType& b) const
+        {
+            const auto& parent = tree_->parent();
+            const auto& order = tree_->order();
+            VectorType y(b);
+            for (const int seg : order) {
+                if (parent[seg] >= 0) {
+                    lower_[seg].mmv(y[seg], y[parent[seg]]);
+                }
+            }
+            x.resize(b.size());
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                const int seg = *it;
+                if (parent[seg] >= 0) {
+                    upper_[seg].mmv(x[parent[seg]], y[seg]);
+                }
+                invS_[seg].mv(y[seg], x[seg]);
+            }
+        }
+
+    private:
+        std::shared_ptr<const SegmentTree> tree_;
+        // inverses of the Schur complements of the diagonal blocks
+        std::vector<Block> invS_;
+        // D(outlet, seg) S_seg^-1 and D(seg, outlet)
+        std::vector<Block> lower_;
+        std::vector<Block> upper_;
+    };
+
+} // namespace mswellhelpers
+
+} // namespace Opm
+
+#endif // OPM_SEGMENTTREESOLVER_HEADER_INCLUDED
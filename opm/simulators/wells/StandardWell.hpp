@@ -25,6 +25,7 @@
 
 #include <opm/simulators/timestepping/ConvergenceReport.hpp>
 #include <opm/simulators/wells/RateConverter.hpp>
+#include <opm/simulators/wells/StandardWellContributions.hpp>
 #include <opm/simulators/wells/StandardWellGeneric.hpp>
 #include <opm/simulators/wells/VFPInjProperties.hpp>
 #include <opm/simulators/wells/VFPProdProperties.hpp>
@@ -131,6 +132,7 @@ namespace Opm
         using Eval = typename StdWellEval::Eval;
         using EvalWell = typename StdWellEval::EvalWell;
         using BVectorWell = typename StdWellEval::BVectorWell;
+        using BatchedContributions = StandardWellContributions<Scalar, Indices::numEq, numStaticWellEq>;
 
         using Base::contiSolventEqIdx;
         using Base::contiZfracEqIdx;
@@ -167,9 +169,17 @@ namespace Opm
 
         /// Ax = Ax - C D^-1 B x
         virtual void apply(const BVector& x, BVector& Ax) const override;
+        /// Ax = Ax - alpha C D^-1 B x
+        virtual void applyScaleAdd(const Scalar alpha, const BVector& x, BVector& Ax) const override;
         /// r = r - C D^-1 Rw
         virtual void apply(BVector& r) const override;
 
+        /// add B, C and D^-1 of this well to the contributions of all standard
+        /// wells, which are then applied together instead of through apply().
+        /// Returns false if the well cannot be batched and must be applied on
+        /// its own, i.e. if it is distributed or has extra well equations.
+        bool addWellContribution(BatchedContributions& contribs) const;
+
         /// using the solution x to recover the solution xw for wells and applying
         /// xw to update Well State
         virtual void recoverWellSolutionAndUpdateWellState(const BVector& x,
@@ -0,0 +1,155 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_STANDARDWELLCONTRIBUTIONS_HEADER_INCLUDED
+#define OPM_STANDARDWELLCONTRIBUTIONS_HEADER_INCLUDED
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace Opm
+{
+
+/// The B, C and D^-1 blocks of many StandardWells packed into contiguous
+/// arrays, so that y -= alpha C^T D^-1 B x is applied for all of them by a
+/// single loop instead of one virtual call and a handful of tiny dense
+/// operations per well. This is the CPU counterpart of the StandardWell
+/// part of WellContributions in bda/.
+///
+/// For well w, the blocks of B and C for the perforated cells are stored
+/// from index wellStart_[w] to wellStart_[w+1], and the column (cell)
+/// index of block k is cols_[k]. B and C have the same sparsity pattern.
+/// Blocks are numWellEq x numEq and row major, D^-1 is numWellEq x
+/// numWellEq per well. The block sizes are compile time constants so the
+/// inner loops can be unrolled and vectorized.
+template <class Scalar, int numEq, int numWellEq>
+class StandardWellContributions
+{
+public:
+    static constexpr int offDiagBlockSize = numWellEq * numEq;
+    static constexpr int diagBlockSize = numWellEq * numWellEq;
+
+    /// Remove all wells, keeping the allocated memory.
+    void clear()
+    {
+        wellStart_.assign(1, 0);
+        cols_.clear();
+        B_.clear();
+        C_.clear();
+        invD_.clear();
+    }
+
+    /// Number of wells added since the last clear().
+    std::size_t numWells() const
+    {
+        return wellStart_.empty() ? 0 : wellStart_.size() - 1;
+    }
+
+    bool empty() const
+    {
+        return numWells() == 0;
+    }
+
+    /// Add a well given the (only) rows of its B and C matrices and its
+    /// D^-1 block, with blocks that support [i][j] access.
+    template <class OffDiagRow, class DiagBlock>
+    void addWell(const OffDiagRow& B, const OffDiagRow& C, const DiagBlock& invD)
+    {
+        if (wellStart_.empty()) {
+            wellStart_.push_back(0);
+        }
+        auto colC = C.begin();
+        for (auto colB = B.begin(); colB != B.end(); ++colB, ++colC) {
+            if (colC == C.end() || colC.index() != colB.index()) {
+                OPM_THROW(std::logic_error, "B and C must have the same sparsity pattern in StandardWellContributions::addWell()");
+            }
+            cols_.push_back(colB.index());
+            appendBlock<numWellEq, numEq>(*colB, B_);
+            appendBlock<numWellEq, numEq>(*colC, C_);
+        }
+        appendBlock<numWellEq, numWellEq>(invD, invD_);
+        wellStart_.push_back(cols_.size());
+    }
+
+    /// y -= alpha C^T D^-1 B x for all wells.
+    template <class BVector>
+    void applyScaleAdd(const Scalar alpha, const BVector& x, BVector& y) const
+    {
+        const std::size_t nw = numWells();
+        for (std::size_t w = 0; w < nw; ++w) {
+            // z1 = B x
+            std::array<Scalar, numWellEq> z1{};
+            for (auto k = wellStart_[w]; k < wellStart_[w + 1]; ++k) {
+                const Scalar* b = &B_[k * offDiagBlockSize];
+                const auto& xc = x[cols_[k]];
+                for (int i = 0; i < numWellEq; ++i) {
+                    for (int j = 0; j < numEq; ++j) {
+                        z1[i] += b[i * numEq + j] * xc[j];
+                    }
+                }
+            }
+
+            // z2 = alpha D^-1 z1
+            std::array<Scalar, numWellEq> z2{};
+            const Scalar* d = &invD_[w * diagBlockSize];
+            for (int i = 0; i < numWellEq; ++i) {
+                for (int j = 0; j < numWellEq; ++j) {
+                    z2[i] += d[i * numWellEq + j] * z1[j];
+                }
+                z2[i] *= alpha;
+            }
+
+            // y -= C^T z2
+            for (auto k = wellStart_[w]; k < wellStart_[w + 1]; ++k) {
+                const Scalar* c = &C_[k * offDiagBlockSize];
+                auto& yc = y[cols_[k]];
+                for (int i = 0; i < numWellEq; ++i) {
+                    for (int j = 0; j < numEq; ++j) {
+                        yc[j] -= c[i * numEq + j] * z2[i];
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    template <int rows, int cols, class Block>
+    static void appendBlock(const Block& block, std::vector<Scalar>& values)
+    {
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                values.push_back(block[i][j]);
+            }
+        }
+    }
+
+    std::vector<std::size_t> wellStart_ = {0};
+    std::vector<int> cols_;
+    std::vector<Scalar> B_;
+    std::vector<Scalar> C_;
+    std::vector<Scalar> invD_;
+};
+
+} // namespace Opm
+
+#endif // OPM_STANDARDWELLCONTRIBUTIONS_HEADER_INCLUDED
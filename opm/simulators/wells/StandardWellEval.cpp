@@ -975,6 +975,7 @@ init(std::vector<double>& perf_depth,
         const int cell_idx = baseif_.cells()[perf];
         perf_depth[perf] = depth_arg[cell_idx];
     }
+    this->perf_depth_above_.reset();
 
     // counting/updating primary variable numbers
     if (has_polymermw) {
@@ -177,7 +177,12 @@ computeConnectionPressureDelta()
 
     const int nperf = baseif_.numPerfs();
     perf_pressure_diffs_.resize(nperf, 0.0);
-    auto z_above = baseif_.parallelWellInfo().communicateAboveValues(baseif_.refDepth(), baseif_.perfDepth());
+    // The depths only change with the well, so the depths above are only
+    // communicated the first time.
+    if (!perf_depth_above_) {
+        perf_depth_above_ = baseif_.parallelWellInfo().communicateAboveValues(baseif_.refDepth(), baseif_.perfDepth());
+    }
+    const auto& z_above = *perf_depth_above_;
 
     for (int perf = 0; perf < nperf; ++perf) {
         const double dz = baseif_.perfDepth()[perf] - z_above[perf];
@@ -360,10 +365,11 @@ computeBhpAtThpLimitProdWithAlq(const std::function<std::vector<double>(const do
     const double vfp_ref_depth = table.getDatumDepth();
     const double thp_limit = baseif_.getTHPConstraint(summary_state);
     const double dp = wellhelpers::computeHydrostaticCorrection(baseif_.refDepth(), vfp_ref_depth, getRho(), baseif_.gravity());
-    auto fbhp = [this, &controls, thp_limit, dp, alq_value](const std::vector<double>& rates) {
+    detail::VFPInterpCache vfp_cache;
+    auto fbhp = [this, &controls, thp_limit, dp, alq_value, &vfp_cache](const std::vector<double>& rates) {
         assert(rates.size() == 3);
         return baseif_.vfpProperties()->getProd()
-        ->bhp(controls.vfp_table_number, rates[Water], rates[Oil], rates[Gas], thp_limit, alq_value) - dp;
+        ->bhp(controls.vfp_table_number, rates[Water], rates[Oil], rates[Gas], thp_limit, alq_value, vfp_cache) - dp;
     };
 
     // Make the flo() function.
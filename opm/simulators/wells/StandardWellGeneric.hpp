@@ -129,6 +129,9 @@ protected:
     std::vector<double> perf_densities_;
     // pressure drop between different perforations
     std::vector<double> perf_pressure_diffs_;
+    // depth of the perforation above each perforation (the reference
+    // depth for the first one), set in computeConnectionPressureDelta()
+    std::optional<std::vector<double>> perf_depth_above_;
 
     // Enable GLIFT debug mode. This will enable output of logging messages.
     bool glift_debug = false;
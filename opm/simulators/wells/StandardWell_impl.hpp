@@ -1579,6 +1579,55 @@ namespace Opm
 
 
 
+    template<typename TypeTag>
+    void
+    StandardWell<TypeTag>::
+    applyScaleAdd(const Scalar alpha, const BVector& x, BVector& Ax) const
+    {
+        if (!this->isOperable() && !this->wellIsStopped()) return;
+
+        if ( param_.matrix_add_well_contributions_ )
+        {
+            // Contributions are already in the matrix itself
+            return;
+        }
+        assert( this->Bx_.size() == this->duneB_.N() );
+        assert( this->invDrw_.size() == this->invDuneD_.N() );
+
+        // Bx_ = duneB_ * x
+        this->parallelB_.mv(x, this->Bx_);
+
+        // invDBx = alpha * invDuneD_ * Bx_, scaled in the (small) well space
+        BVectorWell& invDBx = this->invDrw_;
+        this->invDuneD_.mv(this->Bx_, invDBx);
+        invDBx *= alpha;
+
+        // Ax = Ax - duneC_^T * invDBx, which only touches the perforated cells
+        this->duneC_.mmtv(invDBx,Ax);
+    }
+
+
+
+
+    template<typename TypeTag>
+    bool
+    StandardWell<TypeTag>::
+    addWellContribution(BatchedContributions& contribs) const
+    {
+        // nothing to apply, see apply()
+        if (!this->isOperable() && !this->wellIsStopped()) return true;
+
+        if (this->parallel_well_info_.communication().size() > 1 ||
+            this->numWellEq_ != numStaticWellEq) {
+            return false;
+        }
+        contribs.addWell(this->duneB_[0], this->duneC_[0], this->invDuneD_[0][0]);
+        return true;
+    }
+
+
+
+
     template<typename TypeTag>
     void
     StandardWell<TypeTag>::
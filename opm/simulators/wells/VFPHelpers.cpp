@@ -27,6 +27,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <stdexcept>
@@ -79,6 +80,12 @@ namespace Opm {
 namespace detail {
 
 InterpData findInterpData(const double value_in, const std::vector<double>& values)
+{
+    int bracket = -1;
+    return findInterpData(value_in, values, bracket);
+}
+
+InterpData findInterpData(const double value_in, const std::vector<double>& values, int& bracket)
 {
     InterpData retval;
 
@@ -108,15 +115,18 @@ InterpData findInterpData(const double value_in, const std::vector<double>& valu
             retval.ind_[1] = nvalues-1;
         }
         else {
-            //Search internal intervals
-            for (int i=1; i<nvalues; ++i) {
-                if (values[i] >= value) {
-                    retval.ind_[0] = i-1;
-                    retval.ind_[1] = i;
-                    break;
-                }
+            //Search internal intervals for the first value >= value, unless
+            //value is still in the interval of the previous lookup
+            const bool same_interval = bracket >= 0 && bracket < nvalues-1
+                && values[bracket] < value && value <= values[bracket+1];
+            if (!same_interval) {
+                const auto it = std::lower_bound(values.begin()+1, values.end(), value);
+                bracket = static_cast<int>(it - values.begin()) - 1;
             }
+            retval.ind_[0] = bracket;
+            retval.ind_[1] = bracket+1;
         }
+        bracket = retval.ind_[0];
 
         const double start = values[retval.ind_[0]];
         const double end   = values[retval.ind_[1]];
@@ -346,19 +356,37 @@ VFPEvaluation bhp(const VFPProdTable& table,
                   const double  vapour,
                   const double  thp,
                   const double  alq)
+{
+    VFPInterpCache cache;
+    return bhp(table, aqua, liquid, vapour, thp, alq, cache);
+}
+
+VFPEvaluation bhp(const VFPProdTable& table,
+                  const double  aqua,
+                  const double  liquid,
+                  const double  vapour,
+                  const double  thp,
+                  const double  alq,
+                  VFPInterpCache& cache)
 {
     //Find interpolation variables
     double flo = detail::getFlo(table, aqua, liquid, vapour);
     double wfr = detail::getWFR(table, aqua, liquid, vapour);
     double gfr = detail::getGFR(table, aqua, liquid, vapour);
 
+    //The cached intervals are only valid for the table they were found in
+    if (cache.table_id != table.getTableNum()) {
+        cache = VFPInterpCache{};
+        cache.table_id = table.getTableNum();
+    }
+
     //First, find the values to interpolate between
     //Recall that flo is negative in Opm, so switch sign.
-    auto flo_i = detail::findInterpData(-flo, table.getFloAxis());
-    auto thp_i = detail::findInterpData( thp, table.getTHPAxis());
-    auto wfr_i = detail::findInterpData( wfr, table.getWFRAxis());
-    auto gfr_i = detail::findInterpData( gfr, table.getGFRAxis());
-    auto alq_i = detail::findInterpData( alq, table.getALQAxis());
+    auto flo_i = detail::findInterpData(-flo, table.getFloAxis(), cache.flo);
+    auto thp_i = detail::findInterpData( thp, table.getTHPAxis(), cache.thp);
+    auto wfr_i = detail::findInterpData( wfr, table.getWFRAxis(), cache.wfr);
+    auto gfr_i = detail::findInterpData( gfr, table.getGFRAxis(), cache.gfr);
+    auto alq_i = detail::findInterpData( alq, table.getALQAxis(), cache.alq);
 
     detail::VFPEvaluation retval = detail::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
 
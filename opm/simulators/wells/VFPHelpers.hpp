@@ -96,6 +96,30 @@ struct InterpData {
  */
 InterpData findInterpData(const double value_in, const std::vector<double>& values);
 
+/**
+ * As above, but starting from a known interval
+ *  @param bracket Lower index of the interval found by the previous call for
+ *                 the same axis, or -1. If value_in is still inside that
+ *                 interval it is reused, otherwise the axis is searched. On
+ *                 return it holds the lower index of the interval used.
+ */
+InterpData findInterpData(const double value_in, const std::vector<double>& values, int& bracket);
+
+/**
+ * The intervals used by the previous evaluation of a production table, one per
+ * axis. Successive evaluations for one well (e.g. while solving for the bhp at
+ * the thp limit) mostly stay in the same cell of the table, and can then skip
+ * the searches along the axes.
+ */
+struct VFPInterpCache {
+    int table_id = -1;
+    int flo = -1;
+    int thp = -1;
+    int wfr = -1;
+    int gfr = -1;
+    int alq = -1;
+};
+
 /**
  * An "ADB-like" structure with a single value and a set of derivatives
  */
@@ -138,6 +162,14 @@ VFPEvaluation bhp(const VFPProdTable& table,
                   const double thp,
                   const double alq);
 
+VFPEvaluation bhp(const VFPProdTable& table,
+                  const double aqua,
+                  const double liquid,
+                  const double vapour,
+                  const double thp,
+                  const double alq,
+                  VFPInterpCache& cache);
+
 VFPEvaluation bhp(const VFPInjTable& table,
                   const double aqua,
                   const double liquid,
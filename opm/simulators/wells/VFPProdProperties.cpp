@@ -20,6 +20,8 @@
 #include "config.h"
 #include <opm/simulators/wells/VFPProdProperties.hpp>
 
+#include <opm/common/ErrorMacros.hpp>
+
 #include <opm/material/densead/Math.hpp>
 #include <opm/material/densead/Evaluation.hpp>
 
@@ -27,6 +29,7 @@
 
 #include <opm/simulators/wells/VFPHelpers.hpp>
 
+#include <stdexcept>
 
 
 namespace Opm {
@@ -95,6 +98,44 @@ double VFPProdProperties::bhp(int table_id,
 }
 
 
+double VFPProdProperties::bhp(int table_id,
+                              const double& aqua,
+                              const double& liquid,
+                              const double& vapour,
+                              const double& thp_arg,
+                              const double& alq,
+                              detail::VFPInterpCache& cache) const {
+    const VFPProdTable& table = detail::getTable(m_tables, table_id);
+
+    detail::VFPEvaluation retval = detail::bhp(table, aqua, liquid, vapour, thp_arg, alq, cache);
+    return retval.value;
+}
+
+
+std::vector<double> VFPProdProperties::bhp(int table_id,
+                                           const std::vector<double>& aqua,
+                                           const std::vector<double>& liquid,
+                                           const std::vector<double>& vapour,
+                                           const std::vector<double>& thp_arg,
+                                           const std::vector<double>& alq) const {
+    const std::size_t n = aqua.size();
+    if (liquid.size() != n || vapour.size() != n || thp_arg.size() != n || alq.size() != n) {
+        OPM_THROW(std::invalid_argument, "All inputs to the batched VFPProdProperties::bhp() must have the same size");
+    }
+
+    const VFPProdTable& table = detail::getTable(m_tables, table_id);
+
+    // Neighbouring points are often in the same cell of the table, so
+    // the intervals found for one point are tried first for the next.
+    detail::VFPInterpCache cache;
+    std::vector<double> bhps(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        bhps[i] = detail::bhp(table, aqua[i], liquid[i], vapour[i], thp_arg[i], alq[i], cache).value;
+    }
+    return bhps;
+}
+
+
 const VFPProdTable& VFPProdProperties::getTable(const int table_id) const {
     return detail::getTable(m_tables, table_id);
 }
@@ -122,9 +163,10 @@ bhpwithflo(const std::vector<double>& flos,
     const auto alq_i = detail::findInterpData( alq, table.getALQAxis()); //assume constant
 
     std::vector<double> bhps(flos.size(), 0.);
+    int flo_bracket = -1;
     for (size_t i = 0; i < flos.size(); ++i) {
         // Value of FLO is negative in OPM for producers, but positive in VFP table
-        const auto flo_i = detail::findInterpData(-flos[i], table.getFloAxis());
+        const auto flo_i = detail::findInterpData(-flos[i], table.getFloAxis(), flo_bracket);
         const detail::VFPEvaluation bhp_val = detail::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
 
         // TODO: this kind of breaks the conventions for the functions here by putting dp within the function
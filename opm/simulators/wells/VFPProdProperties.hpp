@@ -20,6 +20,8 @@
 #ifndef OPM_AUTODIFF_VFPPRODPROPERTIES_HPP_
 #define OPM_AUTODIFF_VFPPRODPROPERTIES_HPP_
 
+#include <opm/simulators/wells/VFPHelpers.hpp>
+
 #include <functional>
 #include <map>
 #include <vector>
@@ -86,6 +88,33 @@ public:
             const double& thp,
             const double& alq) const;
 
+    /**
+     * As above, but reusing the interpolation intervals of the previous
+     * evaluation stored in cache, which is updated. Use one cache per well
+     * (or per sequence of related evaluations), see detail::VFPInterpCache.
+     */
+    double bhp(int table_id,
+            const double& aqua,
+            const double& liquid,
+            const double& vapour,
+            const double& thp,
+            const double& alq,
+            detail::VFPInterpCache& cache) const;
+
+    /**
+     * Linear interpolation of bhp for a batch of points in the same table,
+     * e.g. several wells or several values of alq for one well. All input
+     * vectors must have the same size.
+     *
+     * @return The bottom hole pressure for each point.
+     */
+    std::vector<double> bhp(int table_id,
+                            const std::vector<double>& aqua,
+                            const std::vector<double>& liquid,
+                            const std::vector<double>& vapour,
+                            const std::vector<double>& thp,
+                            const std::vector<double>& alq) const;
+
     /**
      * Linear interpolation of thp as a function of the input parameters
      * @param table_id Table number to use
@@ -28,13 +28,15 @@
 #include <opm/simulators/utils/DeferredLogger.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 #include <opm/simulators/wells/GroupState.hpp>
+#include <opm/simulators/wells/GroupTree.hpp>
 #include <opm/simulators/wells/TargetCalculator.hpp>
 #include <opm/simulators/wells/VFPProdProperties.hpp>
 #include <opm/simulators/wells/WellState.hpp>
-#include <opm/simulators/wells/WellContainer.hpp>
+#include <opm/simulators/wells/WellPhaseContainer.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <set>
 #include <stack>
 
@@ -126,7 +128,7 @@ namespace WellGroupHelpers
                 schedule.getGroup(group.parent(), reportStepIdx), schedule, reportStepIdx, factor);
     }
 
-    double sumWellPhaseRates(const WellContainer<std::vector<double>>& rates,
+    double sumWellPhaseRates(const WellPhaseContainer<double>& rates,
                              const Group& group,
                              const Schedule& schedule,
                              const WellState& wellState,
@@ -297,31 +299,38 @@ namespace WellGroupHelpers
         }
     }
 
-    void updateGroupTargetReduction(const Group& group,
-                                    const Schedule& schedule,
-                                    const int reportStepIdx,
-                                    const bool isInjector,
-                                    const PhaseUsage& pu,
-                                    const GuideRate& guide_rate,
-                                    const WellState& wellStateNupcol,
-                                    WellState& wellState,
-                                    GroupState& group_state,
-                                    std::vector<double>& groupTargetReduction)
+    namespace {
+
+    void updateGroupTargetReductionRecursive(const Group& group,
+                                             const Schedule& schedule,
+                                             const int reportStepIdx,
+                                             const bool isInjector,
+                                             const PhaseUsage& pu,
+                                             const GuideRate& guide_rate,
+                                             const GroupTree& tree,
+                                             const std::vector<double>& subtreeRates,
+                                             const WellState& wellStateNupcol,
+                                             WellState& wellState,
+                                             GroupState& group_state,
+                                             std::vector<double>& groupTargetReduction)
     {
         const int np = wellState.numPhases();
         for (const std::string& subGroupName : group.groups()) {
             std::vector<double> subGroupTargetReduction(np, 0.0);
             const Group& subGroup = schedule.getGroup(subGroupName, reportStepIdx);
-            updateGroupTargetReduction(subGroup,
-                                       schedule,
-                                       reportStepIdx,
-                                       isInjector,
-                                       pu,
-                                       guide_rate,
-                                       wellStateNupcol,
-                                       wellState,
-                                       group_state,
-                                       subGroupTargetReduction);
+            const double* subGroupRates = &subtreeRates[tree.groupId(subGroupName) * np];
+            updateGroupTargetReductionRecursive(subGroup,
+                                                schedule,
+                                                reportStepIdx,
+                                                isInjector,
+                                                pu,
+                                                guide_rate,
+                                                tree,
+                                                subtreeRates,
+                                                wellStateNupcol,
+                                                wellState,
+                                                group_state,
+                                                subGroupTargetReduction);
 
             // accumulate group contribution from sub group
             if (isInjector) {
@@ -338,8 +347,7 @@ namespace WellGroupHelpers
                 }
                 if (individual_control || num_group_controlled_wells == 0) {
                     for (int phase = 0; phase < np; phase++) {
-                        groupTargetReduction[phase]
-                            += sumWellRates(subGroup, schedule, wellStateNupcol, reportStepIdx, phase, isInjector);
+                        groupTargetReduction[phase] += subGroupRates[phase];
                     }
                 } else {
                     // The subgroup may participate in group control.
@@ -363,8 +371,7 @@ namespace WellGroupHelpers
                     = groupControlledWells(schedule, wellStateNupcol, group_state, reportStepIdx, subGroupName, "", !isInjector, /*injectionPhaseNotUsed*/Phase::OIL);
                 if (individual_control || num_group_controlled_wells == 0) {
                     for (int phase = 0; phase < np; phase++) {
-                        groupTargetReduction[phase]
-                            += sumWellRates(subGroup, schedule, wellStateNupcol, reportStepIdx, phase, isInjector);
+                        groupTargetReduction[phase] += subGroupRates[phase];
                     }
                 } else {
                     // The subgroup may participate in group control.
@@ -426,6 +433,38 @@ namespace WellGroupHelpers
             group_state.update_production_reduction_rates(group.name(), groupTargetReduction);
     }
 
+    } // anonymous namespace
+
+    void updateGroupTargetReduction(const Group& group,
+                                    const Schedule& schedule,
+                                    const int reportStepIdx,
+                                    const bool isInjector,
+                                    const PhaseUsage& pu,
+                                    const GuideRate& guide_rate,
+                                    const GroupTree& tree,
+                                    const WellState& wellStateNupcol,
+                                    WellState& wellState,
+                                    GroupState& group_state,
+                                    std::vector<double>& groupTargetReduction)
+    {
+        // The rates of the groups without group controlled wells are the sums
+        // over their whole subtree, computed in one pass here instead of again
+        // for every group on the way down.
+        const auto subtreeRates = tree.sumWellPhaseRates(wellStateNupcol.wellRates(), wellStateNupcol, isInjector);
+        updateGroupTargetReductionRecursive(group,
+                                            schedule,
+                                            reportStepIdx,
+                                            isInjector,
+                                            pu,
+                                            guide_rate,
+                                            tree,
+                                            subtreeRates,
+                                            wellStateNupcol,
+                                            wellState,
+                                            group_state,
+                                            groupTargetReduction);
+    }
+
     void updateWellRatesFromGroupTargetScale(const double scale,
                                              const Group& group,
                                              const Schedule& schedule,
@@ -497,54 +536,30 @@ namespace WellGroupHelpers
     }
 
 
-    void updateVREPForGroups(const Group& group,
-                             const Schedule& schedule,
-                             const int reportStepIdx,
+    void updateVREPForGroups(const GroupTree& tree,
                              const WellState& wellStateNupcol,
-                             WellState& wellState,
+                             const WellState& wellState,
                              GroupState& group_state)
     {
-        for (const std::string& groupName : group.groups()) {
-            const Group& groupTmp = schedule.getGroup(groupName, reportStepIdx);
-            updateVREPForGroups(groupTmp, schedule, reportStepIdx, wellStateNupcol, wellState, group_state);
-        }
-        const int np = wellState.numPhases();
-        double resv = 0.0;
-        for (int phase = 0; phase < np; ++phase) {
-            resv += sumWellPhaseRates(wellStateNupcol.wellReservoirRates(),
-                                      group,
-                                      schedule,
-                                      wellState,
-                                      reportStepIdx,
-                                      phase,
-                                      /*isInjector*/ false);
+        const auto resv = tree.sumWellPhaseRates(wellStateNupcol.wellReservoirRates(), wellState, /*isInjector*/ false);
+        const std::size_t np = wellState.numPhases();
+        for (std::size_t group_id = 0; group_id < tree.numGroups(); ++group_id) {
+            const auto begin = resv.begin() + group_id * np;
+            group_state.update_injection_vrep_rate(tree.groupName(group_id), std::accumulate(begin, begin + np, 0.0));
         }
-        group_state.update_injection_vrep_rate(group.name(), resv);
     }
 
-    void updateReservoirRatesInjectionGroups(const Group& group,
-                                             const Schedule& schedule,
-                                             const int reportStepIdx,
+    void updateReservoirRatesInjectionGroups(const GroupTree& tree,
                                              const WellState& wellStateNupcol,
-                                             WellState& wellState,
+                                             const WellState& wellState,
                                              GroupState& group_state)
     {
-        for (const std::string& groupName : group.groups()) {
-            const Group& groupTmp = schedule.getGroup(groupName, reportStepIdx);
-            updateReservoirRatesInjectionGroups(groupTmp, schedule, reportStepIdx, wellStateNupcol, wellState, group_state);
+        const auto resv = tree.sumWellPhaseRates(wellStateNupcol.wellReservoirRates(), wellState, /*isInjector*/ true);
+        const std::size_t np = wellState.numPhases();
+        for (std::size_t group_id = 0; group_id < tree.numGroups(); ++group_id) {
+            const auto begin = resv.begin() + group_id * np;
+            group_state.update_injection_reservoir_rates(tree.groupName(group_id), {begin, begin + np});
         }
-        const int np = wellState.numPhases();
-        std::vector<double> resv(np, 0.0);
-        for (int phase = 0; phase < np; ++phase) {
-            resv[phase] = sumWellPhaseRates(wellStateNupcol.wellReservoirRates(),
-                                            group,
-                                            schedule,
-                                            wellState,
-                                            reportStepIdx,
-                                            phase,
-                                            /*isInjector*/ true);
-        }
-        group_state.update_injection_reservoir_rates(group.name(), resv);
     }
 
     void updateWellRates(const Group& group,
@@ -578,58 +593,47 @@ namespace WellGroupHelpers
         }
     }
 
-    void updateGroupProductionRates(const Group& group,
-                                    const Schedule& schedule,
-                                    const int reportStepIdx,
+    void updateGroupProductionRates(const GroupTree& tree,
                                     const WellState& wellStateNupcol,
-                                    WellState& wellState,
+                                    const WellState& wellState,
                                     GroupState& group_state)
     {
-        for (const std::string& groupName : group.groups()) {
-            const Group& groupTmp = schedule.getGroup(groupName, reportStepIdx);
-            updateGroupProductionRates(groupTmp, schedule, reportStepIdx, wellStateNupcol, wellState, group_state);
+        const auto rates = tree.sumWellPhaseRates(wellStateNupcol.wellRates(), wellState, /*isInjector*/ false);
+        const std::size_t np = wellState.numPhases();
+        for (std::size_t group_id = 0; group_id < tree.numGroups(); ++group_id) {
+            const auto begin = rates.begin() + group_id * np;
+            group_state.update_production_rates(tree.groupName(group_id), {begin, begin + np});
         }
-        const int np = wellState.numPhases();
-        std::vector<double> rates(np, 0.0);
-        for (int phase = 0; phase < np; ++phase) {
-            rates[phase] = sumWellPhaseRates(
-                wellStateNupcol.wellRates(), group, schedule, wellState, reportStepIdx, phase, /*isInjector*/ false);
-        }
-        group_state.update_production_rates(group.name(), rates);
     }
 
 
-    void updateREINForGroups(const Group& group,
+    void updateREINForGroups(const GroupTree& tree,
                              const Schedule& schedule,
-                             const int reportStepIdx,
                              const PhaseUsage& pu,
                              const SummaryState& st,
                              const WellState& wellStateNupcol,
-                             WellState& wellState,
+                             const WellState& wellState,
                              GroupState& group_state)
     {
-        const int np = wellState.numPhases();
-        for (const std::string& groupName : group.groups()) {
-            const Group& groupTmp = schedule.getGroup(groupName, reportStepIdx);
-            updateREINForGroups(groupTmp, schedule, reportStepIdx, pu, st, wellStateNupcol, wellState, group_state);
-        }
-
-        std::vector<double> rein(np, 0.0);
-        for (int phase = 0; phase < np; ++phase) {
-            rein[phase] = sumWellPhaseRates(
-                wellStateNupcol.wellRates(), group, schedule, wellState, reportStepIdx, phase, /*isInjector*/ false);
-        }
-
-        // add import rate and substract consumption rate for group for gas
-        if (schedule[reportStepIdx].gconsump().has(group.name())) {
-            const auto& gconsump = schedule[reportStepIdx].gconsump().get(group.name(), st);
-            if (pu.phase_used[BlackoilPhases::Vapour]) {
-                rein[pu.phase_pos[BlackoilPhases::Vapour]] += gconsump.import_rate;
-                rein[pu.phase_pos[BlackoilPhases::Vapour]] -= gconsump.consumption_rate;
+        const auto rates = tree.sumWellPhaseRates(wellStateNupcol.wellRates(), wellState, /*isInjector*/ false);
+        const std::size_t np = wellState.numPhases();
+        const auto& gconsump = schedule[tree.reportStep()].gconsump();
+        for (std::size_t group_id = 0; group_id < tree.numGroups(); ++group_id) {
+            const auto& gname = tree.groupName(group_id);
+            const auto begin = rates.begin() + group_id * np;
+            std::vector<double> rein(begin, begin + np);
+
+            // add import rate and substract consumption rate for group for gas
+            if (gconsump.has(gname)) {
+                const auto& group_gconsump = gconsump.get(gname, st);
+                if (pu.phase_used[BlackoilPhases::Vapour]) {
+                    rein[pu.phase_pos[BlackoilPhases::Vapour]] += group_gconsump.import_rate;
+                    rein[pu.phase_pos[BlackoilPhases::Vapour]] -= group_gconsump.consumption_rate;
+                }
             }
-        }
 
-        group_state.update_injection_rein_rates(group.name(), rein);
+            group_state.update_injection_rein_rates(gname, rein);
+        }
     }
 
 
@@ -1024,8 +1028,15 @@ namespace WellGroupHelpers
 
 
     std::vector<std::string>
-    groupChainTopBot(const std::string& bottom, const std::string& top, const Schedule& schedule, const int report_step)
+    groupChainTopBot(const std::string& bottom,
+                     const std::string& top,
+                     const Schedule& schedule,
+                     const int report_step,
+                     const GroupTree* group_tree)
     {
+        if (group_tree && group_tree->reportStep() == report_step)
+            return group_tree->chainTopBot(bottom, top);
+
         // Get initial parent, 'bottom' can be a well or a group.
         std::string parent;
         if (schedule.hasWell(bottom, report_step)) {
@@ -1063,6 +1074,7 @@ namespace WellGroupHelpers
                                                       const PhaseUsage& pu,
                                                       const double efficiencyFactor,
                                                       const Schedule& schedule,
+                                                      const GroupTree* group_tree,
                                                       const SummaryState& summaryState,
                                                       const std::vector<double>& resv_coeff,
                                                       DeferredLogger& deferred_logger)
@@ -1095,6 +1107,7 @@ namespace WellGroupHelpers
                                              pu,
                                              efficiencyFactor * group.getGroupEfficiencyFactor(),
                                              schedule,
+                                             group_tree,
                                              summaryState,
                                              resv_coeff,
                                              deferred_logger);
@@ -1131,7 +1144,7 @@ namespace WellGroupHelpers
         // TODO finish explanation.
         const double current_rate
             = -tcalc.calcModeRateFromRates(rates); // Switch sign since 'rates' are negative for producers.
-        const auto chain = groupChainTopBot(name, group.name(), schedule, reportStepIdx);
+        const auto chain = groupChainTopBot(name, group.name(), schedule, reportStepIdx, group_tree);
         // Because 'name' is the last of the elements, and not an ancestor, we subtract one below.
         const size_t num_ancestors = chain.size() - 1;
         // we need to find out the level where the current well is applied to the local reduction 
@@ -1191,6 +1204,7 @@ namespace WellGroupHelpers
                                                      const PhaseUsage& pu,
                                                      const double efficiencyFactor,
                                                      const Schedule& schedule,
+                                                     const GroupTree* group_tree,
                                                      const SummaryState& summaryState,
                                                      const std::vector<double>& resv_coeff,
                                                      DeferredLogger& deferred_logger)
@@ -1224,6 +1238,7 @@ namespace WellGroupHelpers
                                              pu,
                                              efficiencyFactor * group.getGroupEfficiencyFactor(),
                                              schedule,
+                                             group_tree,
                                              summaryState,
                                              resv_coeff,
                                              deferred_logger);
@@ -1258,7 +1273,7 @@ namespace WellGroupHelpers
         // TODO finish explanation.
         const double current_rate
             = tcalc.calcModeRateFromRates(rates); // Switch sign since 'rates' are negative for producers.
-        const auto chain = groupChainTopBot(name, group.name(), schedule, reportStepIdx);
+        const auto chain = groupChainTopBot(name, group.name(), schedule, reportStepIdx, group_tree);
         // Because 'name' is the last of the elements, and not an ancestor, we subtract one below.
         const size_t num_ancestors = chain.size() - 1;
         // we need to find out the level where the current well is applied to the local reduction
@@ -33,6 +33,7 @@ namespace Opm
 class DeferredLogger;
 class Group;
 class GroupState;
+class GroupTree;
 namespace Network { class ExtNetwork; }
 struct PhaseUsage;
 class Schedule;
@@ -40,7 +41,7 @@ class VFPProdProperties;
 class WellState;
 
 template <typename>
-class WellContainer;
+class WellPhaseContainer;
 
 namespace Network { class ExtNetwork; }
 
@@ -61,7 +62,7 @@ namespace WellGroupHelpers
                                          const int reportStepIdx,
                                          double& factor);
 
-    double sumWellPhaseRates(const WellContainer<std::vector<double>>& rates,
+    double sumWellPhaseRates(const WellPhaseContainer<double>& rates,
                              const Group& group,
                              const Schedule& schedule,
                              const WellState& wellState,
@@ -95,6 +96,7 @@ namespace WellGroupHelpers
                                     const bool isInjector,
                                     const PhaseUsage& pu,
                                     const GuideRate& guide_rate,
+                                    const GroupTree& tree,
                                     const WellState& wellStateNupcol,
                                     WellState& wellState,
                                     GroupState& group_state,
@@ -145,18 +147,14 @@ namespace WellGroupHelpers
                                             GuideRate* guideRate,
                                             Opm::DeferredLogger& deferred_logger);
 
-    void updateVREPForGroups(const Group& group,
-                             const Schedule& schedule,
-                             const int reportStepIdx,
+    void updateVREPForGroups(const GroupTree& tree,
                              const WellState& wellStateNupcol,
-                             WellState& wellState,
+                             const WellState& wellState,
                              GroupState& group_state);
 
-    void updateReservoirRatesInjectionGroups(const Group& group,
-                                             const Schedule& schedule,
-                                             const int reportStepIdx,
+    void updateReservoirRatesInjectionGroups(const GroupTree& tree,
                                              const WellState& wellStateNupcol,
-                                             WellState& wellState,
+                                             const WellState& wellState,
                                              GroupState& group_state);
 
     void updateWellRates(const Group& group,
@@ -165,11 +163,9 @@ namespace WellGroupHelpers
                          const WellState& wellStateNupcol,
                          WellState& wellState);
 
-    void updateGroupProductionRates(const Group& group,
-                                    const Schedule& schedule,
-                                    const int reportStepIdx,
+    void updateGroupProductionRates(const GroupTree& tree,
                                     const WellState& wellStateNupcol,
-                                    WellState& wellState,
+                                    const WellState& wellState,
                                     GroupState& group_state);
 
     void updateWellRatesFromGroupTargetScale(const double scale,
@@ -180,13 +176,12 @@ namespace WellGroupHelpers
                                              const GroupState& group_state,
                                              WellState& wellState);
 
-    void updateREINForGroups(const Group& group,
+    void updateREINForGroups(const GroupTree& tree,
                              const Schedule& schedule,
-                             const int reportStepIdx,
                              const PhaseUsage& pu,
                              const SummaryState& st,
                              const WellState& wellStateNupcol,
-                             WellState& wellState,
+                             const WellState& wellState,
                              GroupState& group_state);
 
     std::map<std::string, double>
@@ -278,6 +273,7 @@ namespace WellGroupHelpers
                                                      const PhaseUsage& pu,
                                                      const double efficiencyFactor,
                                                      const Schedule& schedule,
+                                                     const GroupTree* group_tree,
                                                      const SummaryState& summaryState,
                                                      const std::vector<double>& resv_coeff,
                                                      DeferredLogger& deferred_logger);
@@ -287,10 +283,14 @@ namespace WellGroupHelpers
 
 
 
+    /// The names from @top down to @bottom, where @bottom is a well or a
+    /// group below @top. If @group_tree is given and was built for
+    /// @report_step the chain is read from it instead of the schedule.
     std::vector<std::string> groupChainTopBot(const std::string& bottom,
                                               const std::string& top,
                                               const Schedule& schedule,
-                                              const int report_step);
+                                              const int report_step,
+                                              const GroupTree* group_tree);
 
 
 
@@ -306,6 +306,7 @@ namespace WellGroupHelpers
                                                       const PhaseUsage& pu,
                                                       const double efficiencyFactor,
                                                       const Schedule& schedule,
+                                                      const GroupTree* group_tree,
                                                       const SummaryState& summaryState,
                                                       const std::vector<double>& resv_coeff,
                                                       DeferredLogger& deferred_logger);
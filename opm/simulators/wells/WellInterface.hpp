@@ -164,6 +164,16 @@ public:
                         const GroupState& group_state,
                         DeferredLogger& deferred_logger);
 
+    /// assembleWellEq() without the initial operability check, for callers
+    /// that already did checkWellOperability(). old_well_operable is the
+    /// operability before that check.
+    void assembleWellEqAfterOperabilityCheck(const Simulator& ebosSimulator,
+                                             const double dt,
+                                             const bool old_well_operable,
+                                             WellState& well_state,
+                                             const GroupState& group_state,
+                                             DeferredLogger& deferred_logger);
+
     virtual void gasLiftOptimizationStage1 (
         WellState& well_state,
         const GroupState& group_state,
@@ -185,6 +195,9 @@ public:
     /// Ax = Ax - C D^-1 B x
     virtual void apply(const BVector& x, BVector& Ax) const = 0;
 
+    /// Ax = Ax - alpha C D^-1 B x, only touching the perforated cells
+    virtual void applyScaleAdd(const Scalar alpha, const BVector& x, BVector& Ax) const = 0;
+
     /// r = r - C D^-1 Rw
     virtual void apply(BVector& r) const = 0;
 
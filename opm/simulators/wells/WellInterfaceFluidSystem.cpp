@@ -327,6 +327,7 @@ checkGroupConstraintsInj(const Group& group,
                                                       phaseUsage(),
                                                       efficiencyFactor,
                                                       schedule,
+                                                      group_tree_,
                                                       summaryState,
                                                       resv_coeff,
                                                       deferred_logger);
@@ -358,6 +359,7 @@ checkGroupConstraintsProd(const Group& group,
                                                        phaseUsage(),
                                                        efficiencyFactor,
                                                        schedule,
+                                                       group_tree_,
                                                        summaryState,
                                                        resv_coeff,
                                                        deferred_logger);
@@ -1010,7 +1012,7 @@ getGroupInjectionTargetRate(const Group& group,
     };
 
     const double orig_target = tcalc.groupTarget(group.injectionControls(injectionPhase, summaryState), deferred_logger);
-    const auto chain = WellGroupHelpers::groupChainTopBot(name(), group.name(), schedule, currentStep());
+    const auto chain = WellGroupHelpers::groupChainTopBot(name(), group.name(), schedule, currentStep(), groupTree());
     // Because 'name' is the last of the elements, and not an ancestor, we subtract one below.
     const size_t num_ancestors = chain.size() - 1;
     double target = orig_target;
@@ -1082,7 +1084,7 @@ getGroupProductionTargetRate(const Group& group,
     };
 
     const double orig_target = tcalc.groupTarget(group.productionControls(summaryState));
-    const auto chain = WellGroupHelpers::groupChainTopBot(name(), group.name(), schedule, currentStep());
+    const auto chain = WellGroupHelpers::groupChainTopBot(name(), group.name(), schedule, currentStep(), groupTree());
     // Because 'name' is the last of the elements, and not an ancestor, we subtract one below.
     const size_t num_ancestors = chain.size() - 1;
     double target = orig_target;
@@ -1098,7 +1100,7 @@ getGroupProductionTargetRate(const Group& group,
     // Avoid negative target rates coming from too large local reductions.
     const double target_rate = std::max(0.0, target / efficiencyFactor);
     const auto& rates = well_state.wellRates(index_of_well_);
-    const auto current_rate = -tcalc.calcModeRateFromRates(rates); // Switch sign since 'rates' are negative for producers.
+    const auto current_rate = -tcalc.calcModeRateFromRates(rates.data()); // Switch sign since 'rates' are negative for producers.
     double scale = 1.0;
     if (current_rate > 1e-14)
         scale = target_rate/current_rate;
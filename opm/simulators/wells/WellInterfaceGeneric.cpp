@@ -251,6 +251,11 @@ void WellInterfaceGeneric::setGuideRate(const GuideRate* guide_rate_arg)
     guide_rate_ = guide_rate_arg;
 }
 
+void WellInterfaceGeneric::setGroupTree(const GroupTree* group_tree_arg)
+{
+    group_tree_ = group_tree_arg;
+}
+
 void WellInterfaceGeneric::setWellEfficiencyFactor(const double efficiency_factor)
 {
     well_efficiency_factor_ = efficiency_factor;
@@ -44,6 +44,7 @@ class VFPProperties;
 class WellTestState;
 class WellState;
 class GroupState;
+class GroupTree;
 class Group;
 class Schedule;
 
@@ -88,6 +89,7 @@ public:
 
     void setVFPProperties(const VFPProperties* vfp_properties_arg);
     void setGuideRate(const GuideRate* guide_rate_arg);
+    void setGroupTree(const GroupTree* group_tree_arg);
     void setWellEfficiencyFactor(const double efficiency_factor);
     void setRepRadiusPerfLength(const std::vector<int>& cartesian_to_compressed);
     void setWsolvent(const double wsolvent);
@@ -121,6 +123,10 @@ public:
         return guide_rate_;
     }
 
+    const GroupTree* groupTree() const {
+        return group_tree_;
+    }
+
     int numComponents() const {
         return num_components_;
     }
@@ -302,6 +308,9 @@ protected:
     double well_efficiency_factor_;
     const VFPProperties* vfp_properties_;
     const GuideRate* guide_rate_;
+    // The group tree of the well model, if any. Only used to look up the
+    // chain of groups above the well.
+    const GroupTree* group_tree_ = nullptr;
 };
 
 }
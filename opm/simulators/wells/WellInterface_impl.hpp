@@ -379,7 +379,22 @@ namespace Opm
     {
         const bool old_well_operable = this->operability_status_.isOperable();
         checkWellOperability(ebosSimulator, well_state, deferred_logger);
+        assembleWellEqAfterOperabilityCheck(ebosSimulator, dt, old_well_operable,
+                                            well_state, group_state, deferred_logger);
+    }
+
 
+
+    template <typename TypeTag>
+    void
+    WellInterface<TypeTag>::
+    assembleWellEqAfterOperabilityCheck(const Simulator& ebosSimulator,
+                                        const double dt,
+                                        const bool old_well_operable,
+                                        WellState& well_state,
+                                        const GroupState& group_state,
+                                        DeferredLogger& deferred_logger)
+    {
         // only use inner well iterations for the first newton iterations.
         const int iteration_idx = ebosSimulator.model().newtonMethod().numIterations();
         bool converged = true;
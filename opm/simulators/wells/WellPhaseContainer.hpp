@@ -0,0 +1,232 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_WELL_PHASE_CONTAINER_HEADER_INCLUDED
+#define OPM_WELL_PHASE_CONTAINER_HEADER_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+
+/*
+  Non owning view of the values of one well in a WellPhaseContainer, i.e. one
+  value per phase. Supports the subset of the std::vector<T> interface which
+  is used for per well phase rates.
+*/
+
+template <class T>
+class WellPhaseSpan {
+public:
+    WellPhaseSpan(T* data, std::size_t size)
+        : m_data(data)
+        , m_size(size)
+    {}
+
+    // A mutable view converts to a const view.
+    template <class U, std::enable_if_t<std::is_same_v<const U, T> && !std::is_same_v<U, T>, int> = 0>
+    WellPhaseSpan(const WellPhaseSpan<U>& other)
+        : m_data(other.data())
+        , m_size(other.size())
+    {}
+
+    T& operator[](std::size_t index) const {
+        return this->m_data[index];
+    }
+
+    std::size_t size() const {
+        return this->m_size;
+    }
+
+    T* data() const {
+        return this->m_data;
+    }
+
+    T* begin() const {
+        return this->m_data;
+    }
+
+    T* end() const {
+        return this->m_data + this->m_size;
+    }
+
+private:
+    T* m_data;
+    std::size_t m_size;
+};
+
+
+/*
+  The WellPhaseContainer<T> class stores a fixed number of values (one per
+  phase) for each well, with the same name and index based access as
+  WellContainer<T>. Contrary to WellContainer<std::vector<T>> all the values
+  are stored in one contiguous num_wells x num_phases array, so copying the
+  container is a single copy of that array and loops over all wells touch
+  contiguous memory.
+
+  The value of the number of phases is fixed by the first call to add(), and
+  reset by clear().
+*/
+
+template <class T>
+class WellPhaseContainer {
+public:
+
+    WellPhaseContainer() = default;
+
+    bool empty() const {
+        return this->index_map.empty();
+    }
+
+    /// Number of wells.
+    std::size_t size() const {
+        return this->index_map.size();
+    }
+
+    std::size_t num_phases() const {
+        return this->m_num_phases;
+    }
+
+    void add(const std::string& name, const std::vector<T>& value) {
+        if (index_map.count(name) != 0)
+            throw std::logic_error("An object with name: " + name + " already exists in container");
+
+        if (this->empty())
+            this->m_num_phases = value.size();
+        else if (value.size() != this->m_num_phases)
+            throw std::logic_error("Wrong number of phases for well: " + name);
+
+        this->index_map.emplace(name, this->size());
+        this->m_data.insert(this->m_data.end(), value.begin(), value.end());
+    }
+
+    bool has(const std::string& name) const {
+        return (index_map.count(name) != 0);
+    }
+
+    /*
+      Will copy the values from other to this - for all wells which are present
+      in both containers.
+    */
+    void copy_welldata(const WellPhaseContainer<T>& other) {
+        if (this->index_map == other.index_map && this->m_num_phases == other.m_num_phases)
+            this->m_data = other.m_data;
+        else {
+            for (const auto& [name, index] : this->index_map)
+                this->update_if(index, name, other);
+        }
+    }
+
+    /*
+      Will copy the values for well @name from other to this. The well @name
+      must exist in both containers, otherwise an exception is thrown.
+    */
+    void copy_welldata(const WellPhaseContainer<T>& other, const std::string& name) {
+        auto this_index = this->index_map.at(name);
+        auto other_index = other.index_map.at(name);
+        this->copy_well(this_index, other, other_index);
+    }
+
+    WellPhaseSpan<T> operator[](std::size_t index) {
+        this->check_index(index);
+        return { this->m_data.data() + index * this->m_num_phases, this->m_num_phases };
+    }
+
+    WellPhaseSpan<const T> operator[](std::size_t index) const {
+        this->check_index(index);
+        return { this->m_data.data() + index * this->m_num_phases, this->m_num_phases };
+    }
+
+    WellPhaseSpan<T> operator[](const std::string& name) {
+        return (*this)[this->index_map.at(name)];
+    }
+
+    WellPhaseSpan<const T> operator[](const std::string& name) const {
+        return (*this)[this->index_map.at(name)];
+    }
+
+    void clear() {
+        this->m_data.clear();
+        this->index_map.clear();
+        this->m_num_phases = 0;
+    }
+
+    /// All values, well by well, i.e. the value for well w and phase p is
+    /// at position w * num_phases() + p.
+    const std::vector<T>& data() const {
+        return this->m_data;
+    }
+
+    std::optional<int> well_index(const std::string& wname) const {
+        auto index_iter = this->index_map.find(wname);
+        if (index_iter != this->index_map.end())
+            return index_iter->second;
+
+        return std::nullopt;
+    }
+
+    const std::string& well_name(std::size_t well_index) const {
+        for (const auto& [wname, windex] : this->index_map) {
+            if (windex == well_index)
+                return wname;
+        }
+        throw std::logic_error("No such well");
+    }
+
+
+private:
+    void check_index(std::size_t index) const {
+        if (index >= this->size())
+            throw std::out_of_range("Well index out of range in WellPhaseContainer");
+    }
+
+    void copy_well(std::size_t index, const WellPhaseContainer<T>& other, std::size_t other_index) {
+        if (this->m_num_phases != other.m_num_phases)
+            throw std::logic_error("Can not copy well data between containers with different number of phases");
+
+        const auto np = this->m_num_phases;
+        std::copy_n(other.m_data.begin() + other_index * np, np, this->m_data.begin() + index * np);
+    }
+
+    void update_if(std::size_t index, const std::string& name, const WellPhaseContainer<T>& other) {
+        auto other_iter = other.index_map.find(name);
+        if (other_iter == other.index_map.end())
+            return;
+
+        this->copy_well(index, other, other_iter->second);
+    }
+
+
+    std::vector<T> m_data;
+    std::size_t m_num_phases = 0;
+    std::unordered_map<std::string, std::size_t> index_map;
+};
+
+
+}
+
+
+#endif
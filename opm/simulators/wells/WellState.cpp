@@ -156,7 +156,7 @@ void WellState::initSingleWell(const std::vector<double>& cellPressures,
         //    (producer) or RATE (injector).
         //    Otherwise, we cannot set the correct
         //    value here and initialize to zero rate.
-        auto& rates = this->wellrates_[w];
+        auto rates = this->wellrates_[w];
         if (well.isInjector()) {
             if (inj_controls.cmode == Well::InjectorCMode::RATE) {
                 switch (inj_controls.injector_type) {
@@ -383,11 +383,10 @@ void WellState::init(const std::vector<double>& cellPressures,
                     current_production_controls_[ newIndex ] = prevState->currentProductionControl(oldIndex);
                 }
 
-                wellRates(w) = prevState->wellRates(oldIndex);
-                wellReservoirRates(w) = prevState->wellReservoirRates(oldIndex);
-
-                // Well potentials
+                // Rates and potentials
                 for (int p=0; p < np; p++) {
+                    this->wellRates(newIndex)[p] = prevState->wellRates(oldIndex)[p];
+                    this->wellReservoirRates(newIndex)[p] = prevState->wellReservoirRates(oldIndex)[p];
                     this->wellPotentials(newIndex)[p] = prevState->wellPotentials(oldIndex)[p];
                 }
 
@@ -852,12 +851,12 @@ void WellState::shutWell(int well_index)
     this->thp_[well_index] = 0;
     this->bhp_[well_index] = 0;
     const int np = numPhases();
-    this->wellrates_[well_index].assign(np, 0);
-
-    auto& resv = this->well_reservoir_rates_[well_index];
-    auto& wpi  = this->productivity_index_[well_index];
+    auto rates = this->wellrates_[well_index];
+    auto resv = this->well_reservoir_rates_[well_index];
+    auto wpi  = this->productivity_index_[well_index];
 
     for (int p = 0; p < np; ++p) {
+        rates[p] = 0.0;
         resv[p] = 0.0;
         wpi[p]  = 0.0;
     }
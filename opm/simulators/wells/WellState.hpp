@@ -25,6 +25,7 @@
 #include <opm/simulators/wells/GlobalWellInfo.hpp>
 #include <opm/simulators/wells/SegmentState.hpp>
 #include <opm/simulators/wells/WellContainer.hpp>
+#include <opm/simulators/wells/WellPhaseContainer.hpp>
 #include <opm/core/props/BlackoilPhases.hpp>
 #include <opm/simulators/wells/PerforationData.hpp>
 #include <opm/simulators/wells/PerfData.hpp>
@@ -160,14 +161,14 @@ public:
     /// One rate pr well
     double brineWellRate(const int w) const;
 
-    const WellContainer<std::vector<double>>& wellReservoirRates() const { return well_reservoir_rates_; }
+    const WellPhaseContainer<double>& wellReservoirRates() const { return well_reservoir_rates_; }
 
-    std::vector<double>& wellReservoirRates(std::size_t well_index)
+    WellPhaseSpan<double> wellReservoirRates(std::size_t well_index)
     {
         return well_reservoir_rates_[well_index];
     }
 
-    const std::vector<double>& wellReservoirRates(std::size_t well_index) const
+    WellPhaseSpan<const double> wellReservoirRates(std::size_t well_index) const
     {
         return well_reservoir_rates_[well_index];
     }
@@ -201,19 +202,19 @@ public:
         return this->segment_state[wname];
     }
 
-    std::vector<double>& productivityIndex(std::size_t well_index) {
+    WellPhaseSpan<double> productivityIndex(std::size_t well_index) {
         return this->productivity_index_[well_index];
     }
 
-    const std::vector<double>& productivityIndex(std::size_t well_index) const {
+    WellPhaseSpan<const double> productivityIndex(std::size_t well_index) const {
         return this->productivity_index_[well_index];
     }
 
-    std::vector<double>& wellPotentials(std::size_t well_index) {
+    WellPhaseSpan<double> wellPotentials(std::size_t well_index) {
         return this->well_potentials_[well_index];
     }
 
-    const std::vector<double>& wellPotentials(std::size_t well_index) const {
+    WellPhaseSpan<const double> wellPotentials(std::size_t well_index) const {
         return this->well_potentials_[well_index];
     }
 
@@ -322,9 +323,9 @@ public:
     double temperature(std::size_t well_index) const { return temperature_[well_index]; }
 
     /// One rate per well and phase.
-    const WellContainer<std::vector<double>>& wellRates() const { return wellrates_; }
-    std::vector<double>& wellRates(std::size_t well_index) { return wellrates_[well_index]; }
-    const std::vector<double>& wellRates(std::size_t well_index) const { return wellrates_[well_index]; }
+    const WellPhaseContainer<double>& wellRates() const { return wellrates_; }
+    WellPhaseSpan<double> wellRates(std::size_t well_index) { return wellrates_[well_index]; }
+    WellPhaseSpan<const double> wellRates(std::size_t well_index) const { return wellrates_[well_index]; }
 
     std::size_t numPerf(std::size_t well_index) const { return this->perfdata[well_index].size(); }
 
@@ -367,7 +368,7 @@ private:
     WellContainer<double> bhp_;
     WellContainer<double> thp_;
     WellContainer<double> temperature_;
-    WellContainer<std::vector<double>> wellrates_;
+    WellPhaseContainer<double> wellrates_;
     PhaseUsage phase_usage_;
     WellContainer<PerfData> perfdata;
 
@@ -386,7 +387,7 @@ private:
 
     // phase rates under reservoir condition for wells
     // or voidage phase rates
-    WellContainer<std::vector<double>> well_reservoir_rates_;
+    WellPhaseContainer<double> well_reservoir_rates_;
 
     // dissolved gas rates or solution gas production rates
     // should be zero for injection wells
@@ -404,10 +405,10 @@ private:
     WellContainer<SegmentState> segment_state;
 
     // Productivity Index
-    WellContainer<std::vector<double>> productivity_index_;
+    WellPhaseContainer<double> productivity_index_;
 
     // Well potentials
-    WellContainer<std::vector<double>> well_potentials_;
+    WellPhaseContainer<double> well_potentials_;
 
 
     data::Segment
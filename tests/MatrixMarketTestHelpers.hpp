@@ -0,0 +1,46 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_MATRIXMARKETTESTHELPERS_HEADER
+#define OPM_MATRIXMARKETTESTHELPERS_HEADER
+
+#include <dune/istl/matrixmarket.hh>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+/// Read a matrix and a right hand side stored in MatrixMarket format.
+template <class Matrix, class Vector>
+void readSystem(const std::string& matrix_filename, const std::string& rhs_filename, Matrix& matrix, Vector& rhs)
+{
+    {
+        std::ifstream mfile(matrix_filename);
+        if (!mfile) {
+            throw std::runtime_error("Could not read matrix file");
+        }
+        readMatrixMarket(matrix, mfile);
+    }
+    {
+        std::ifstream rhsfile(rhs_filename);
+        if (!rhsfile) {
+            throw std::runtime_error("Could not read rhs file");
+        }
+        readMatrixMarket(rhs, rhsfile);
+    }
+}
+
+#endif // OPM_MATRIXMARKETTESTHELPERS_HEADER
@@ -0,0 +1,44 @@
+#!/bin/bash
+
+# This runs a parallel simulator for an increasing number of MPI
+# processes on the same model, once with the standard and once with
+# the pipelined BiCGStab linear solver, and reports the wall time and
+# linear solve time of every run. It is a strong scaling benchmark and
+# only fails if one of the runs fails.
+
+INPUT_DATA_PATH="$1"
+RESULT_PATH="$2"
+BINPATH="$3"
+FILENAME="$4"
+SOLVER_CONFIG="$5"
+RANKS="${6}"
+EXE_NAME="${7}"
+shift 7
+TEST_ARGS="$@"
+
+rm -Rf ${RESULT_PATH}
+mkdir -p ${RESULT_PATH}
+cd ${RESULT_PATH}
+
+# The reference configuration only differs in the Krylov solver.
+sed -e 's/"pipelined_bicgstab"/"bicgstab"/' ${SOLVER_CONFIG} > ${RESULT_PATH}/bicgstab.json
+cp ${SOLVER_CONFIG} ${RESULT_PATH}/pipelined_bicgstab.json
+
+printf "%-20s %6s %12s %18s\n" "solver" "ranks" "wall (ms)" "lin. solve (s)" > ${RESULT_PATH}/scaling.txt
+for solver in bicgstab pipelined_bicgstab
+do
+  for np in ${RANKS//,/ }
+  do
+    OUT=${RESULT_PATH}/${solver}_np${np}
+    mkdir -p ${OUT}
+    start=$(date +%s%N)
+    mpirun -np ${np} ${BINPATH}/${EXE_NAME} ${TEST_ARGS} --linsolver=${RESULT_PATH}/${solver}.json --output-dir=${OUT} > ${OUT}/log.txt 2>&1
+    test $? -eq 0 || { cat ${OUT}/log.txt; exit 1; }
+    wall=$(( ($(date +%s%N) - start) / 1000000 ))
+    linsolve=$(grep "Linear solve time" ${OUT}/log.txt | tail -n 1 | sed -e 's/.*:[ ]*\([0-9.]*\).*/\1/')
+    printf "%-20s %6s %12s %18s\n" ${solver} ${np} ${wall} ${linsolve} >> ${RESULT_PATH}/scaling.txt
+  done
+done
+
+echo "=== Strong scaling of ${FILENAME} ==="
+cat ${RESULT_PATH}/scaling.txt
@@ -0,0 +1,57 @@
+#!/bin/bash
+
+# This runs a simulator once with a single thread and once with
+# several OpenMP threads per process, then compares the summary and
+# restart files from the two runs. The wall times of both runs are
+# reported, so the test doubles as a thread scaling benchmark for the
+# threaded reservoir linearization.
+
+INPUT_DATA_PATH="$1"
+RESULT_PATH="$2"
+BINPATH="$3"
+FILENAME="$4"
+ABS_TOL="$5"
+REL_TOL="$6"
+COMPARE_ECL_COMMAND="$7"
+NUM_THREADS="${8}"
+EXE_NAME="${9}"
+shift 9
+TEST_ARGS="$@"
+
+rm -Rf ${RESULT_PATH}
+mkdir -p ${RESULT_PATH}
+cd ${RESULT_PATH}
+start=$(date +%s%N)
+OMP_NUM_THREADS=1 ${BINPATH}/${EXE_NAME} ${TEST_ARGS} --threads-per-process=1 --output-dir=${RESULT_PATH}
+test $? -eq 0 || exit 1
+serial_time=$(( ($(date +%s%N) - start) / 1000000 ))
+
+mkdir threaded
+cd threaded
+start=$(date +%s%N)
+OMP_NUM_THREADS=${NUM_THREADS} ${BINPATH}/${EXE_NAME} ${TEST_ARGS} --threads-per-process=${NUM_THREADS} --output-dir=${RESULT_PATH}/threaded
+test $? -eq 0 || exit 1
+threaded_time=$(( ($(date +%s%N) - start) / 1000000 ))
+cd ..
+
+echo "=== Wall time with 1 thread: ${serial_time} ms, with ${NUM_THREADS} threads: ${threaded_time} ms ==="
+echo "=== Speedup (x100): $(( 100 * serial_time / (threaded_time > 0 ? threaded_time : 1) )) ==="
+
+ecode=0
+echo "=== Executing comparison for summary file ==="
+${COMPARE_ECL_COMMAND} -t SMRY -R ${RESULT_PATH}/${FILENAME} ${RESULT_PATH}/threaded/${FILENAME} ${ABS_TOL} ${REL_TOL}
+if [ $? -ne 0 ]
+then
+  ecode=1
+  ${COMPARE_ECL_COMMAND} -t SMRY -a -R ${RESULT_PATH}/${FILENAME} ${RESULT_PATH}/threaded/${FILENAME} ${ABS_TOL} ${REL_TOL}
+fi
+
+echo "=== Executing comparison for restart file ==="
+${COMPARE_ECL_COMMAND} -l -t UNRST ${RESULT_PATH}/${FILENAME} ${RESULT_PATH}/threaded/${FILENAME} ${ABS_TOL} ${REL_TOL}
+if [ $? -ne 0 ]
+then
+  ecode=1
+  ${COMPARE_ECL_COMMAND} -a -l -t UNRST ${RESULT_PATH}/${FILENAME} ${RESULT_PATH}/threaded/${FILENAME} ${ABS_TOL} ${REL_TOL}
+fi
+
+exit $ecode
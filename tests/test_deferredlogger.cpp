@@ -33,6 +33,9 @@
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 
+#include <sstream>
+#include <vector>
+
 using namespace Opm;
 
 void initLogger(std::ostringstream& log_stream) {
@@ -98,3 +101,33 @@ BOOST_AUTO_TEST_CASE(deferredlogger)
     BOOST_CHECK_EQUAL(log_stream.str(), expected);
 
 }
+
+BOOST_AUTO_TEST_CASE(appendkeepsorder)
+{
+    const std::string expected = Log::prefixMessage(Log::MessageType::Info, "well 1") + "\n"
+        + Log::prefixMessage(Log::MessageType::Warning, "well 2") + "\n"
+        + Log::prefixMessage(Log::MessageType::Info, "well 3") + "\n";
+
+    std::ostringstream log_stream;
+    initLogger(log_stream);
+    auto deferred_logger = Opm::DeferredLogger();
+    std::vector<Opm::DeferredLogger> well_loggers(3);
+    // Filled in another order than they are appended, as by separate threads.
+    well_loggers[2].info("well 3");
+    well_loggers[0].info("well 1");
+    well_loggers[1].warning("well 2");
+    for (auto& well_logger : well_loggers) {
+        deferred_logger.append(well_logger);
+    }
+
+    deferred_logger.logMessages();
+    BOOST_CHECK_EQUAL(log_stream.str(), expected);
+
+    // The appended loggers are emptied.
+    std::ostringstream empty_stream;
+    initLogger(empty_stream);
+    for (auto& well_logger : well_loggers) {
+        well_logger.logMessages();
+    }
+    BOOST_CHECK_EQUAL(empty_stream.str(), "");
+}
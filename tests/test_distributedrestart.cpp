@@ -0,0 +1,257 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE DistributedRestartTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/DistributedRestart.hpp>
+
+#include <opm/common/utility/FileSystem.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+#include <opm/output/data/Cells.hpp>
+#include <opm/output/data/Solution.hpp>
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+#include <opm/parser/eclipse/Units/Units.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// scratch directory in the working directory of the test
+struct TempDir
+{
+    explicit TempDir(const std::string& name)
+        : path(name)
+    {
+        Opm::filesystem::create_directories(path);
+    }
+
+    ~TempDir()
+    {
+        Opm::filesystem::remove_all(path);
+    }
+
+    Opm::filesystem::path path;
+};
+
+// Rank 0 owns the global cells 0 and 2 and has a ghost cell at local
+// index 1, rank 1 owns the global cells 3 and 1. Only rank 1 has SOMAX.
+void writePartitions(const std::string& basePath, int reportStep, double offset, bool eclCompatible)
+{
+    const auto units = Opm::UnitSystem::newMETRIC();
+    const bool append = reportStep > 1;
+
+    {
+        Opm::data::Solution sol;
+        sol.insert("SWAT", Opm::UnitSystem::measure::identity,
+                   {offset + 0.0, -1.0, offset + 0.2}, Opm::data::TargetType::RESTART_SOLUTION);
+        sol.insert("PRESSURE", Opm::UnitSystem::measure::pressure,
+                   {100.0*Opm::unit::barsa, -1.0, 120.0*Opm::unit::barsa},
+                   Opm::data::TargetType::RESTART_SOLUTION);
+        sol.insert("KRO", Opm::UnitSystem::measure::identity,
+                   {0.5, -1.0, 0.5}, Opm::data::TargetType::RESTART_AUXILIARY);
+        sol.insert("FIPOIL", Opm::UnitSystem::measure::volume,
+                   {1.0, 1.0, 1.0}, Opm::data::TargetType::SUMMARY);
+        Opm::writeDistributedRestartStep(Opm::distributedRestartFileName(basePath, 0),
+                                         append, reportStep, 4,
+                                         {0, 2}, {0, 2}, sol, units, true, eclCompatible);
+    }
+
+    {
+        Opm::data::Solution sol;
+        sol.insert("SWAT", Opm::UnitSystem::measure::identity,
+                   {offset + 0.3, offset + 0.1}, Opm::data::TargetType::RESTART_SOLUTION);
+        sol.insert("PRESSURE", Opm::UnitSystem::measure::pressure,
+                   {130.0*Opm::unit::barsa, 110.0*Opm::unit::barsa},
+                   Opm::data::TargetType::RESTART_SOLUTION);
+        sol.insert("SOMAX", Opm::UnitSystem::measure::identity,
+                   {0.7, 0.7}, Opm::data::TargetType::RESTART_SOLUTION);
+        sol.insert("KRO", Opm::UnitSystem::measure::identity,
+                   {0.5, 0.5}, Opm::data::TargetType::RESTART_AUXILIARY);
+        sol.insert("FIPOIL", Opm::UnitSystem::measure::volume,
+                   {1.0, 1.0}, Opm::data::TargetType::SUMMARY);
+        Opm::writeDistributedRestartStep(Opm::distributedRestartFileName(basePath, 1),
+                                         append, reportStep, 4,
+                                         {0, 1}, {3, 1}, sol, units, true, eclCompatible);
+    }
+}
+
+// A report step of a restart file as written by EclipseIO when the cell
+// data is written to the partition files: headers and a solution section
+// with only the non cell data.
+void writeRestartStep(Opm::EclIO::EclOutput& output, int reportStep)
+{
+    output.write<int>("SEQNUM", {reportStep});
+    output.write<int>("INTEHEAD", std::vector<int>(411, 0));
+    output.write<bool>("LOGIHEAD", std::vector<bool>(121, false));
+    output.write<double>("DOUBHEAD", std::vector<double>(229, 0.0));
+    output.message("STARTSOL");
+    output.write<double>("OPMEXTRA", {1.0});
+    output.message("ENDSOL");
+}
+
+std::vector<std::string> arrayNames(Opm::EclIO::ERst& rst, int reportStep)
+{
+    std::vector<std::string> names;
+    for (const auto& array : rst.listOfRstArrays(reportStep)) {
+        if (std::get<0>(array) != "SEQNUM")
+            names.push_back(std::get<0>(array));
+    }
+    return names;
+}
+
+void checkMergedStep(Opm::EclIO::ERst& rst, int reportStep, double offset)
+{
+    const auto& swat = rst.getRestartData<double>("SWAT", reportStep);
+    BOOST_REQUIRE_EQUAL(swat.size(), 4U);
+    for (int cell = 0; cell < 4; ++cell)
+        BOOST_CHECK_CLOSE(swat[cell], offset + 0.1*cell, 1e-10);
+
+    // converted to bars
+    const auto& pressure = rst.getRestartData<double>("PRESSURE", reportStep);
+    BOOST_REQUIRE_EQUAL(pressure.size(), 4U);
+    for (int cell = 0; cell < 4; ++cell)
+        BOOST_CHECK_CLOSE(pressure[cell], 100.0 + 10.0*cell, 1e-10);
+
+    // the cells of rank 0 do not have the array
+    const auto& somax = rst.getRestartData<double>("SOMAX", reportStep);
+    const std::vector<double> expected {0.0, 0.7, 0.0, 0.7};
+    BOOST_CHECK_EQUAL_COLLECTIONS(somax.begin(), somax.end(), expected.begin(), expected.end());
+
+    BOOST_CHECK_EQUAL(rst.getRestartData<double>("OPMEXTRA", reportStep)[0], 1.0);
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(MergeIntoUnifiedRestart)
+{
+    TempDir dir("drst_unified");
+    const std::string basePath = (dir.path / "CASE").string();
+
+    {
+        Opm::EclIO::EclOutput output(basePath + ".UNRST", false);
+        for (int reportStep = 0; reportStep < 3; ++reportStep)
+            writeRestartStep(output, reportStep);
+    }
+    writePartitions(basePath, 1, 0.0, false);
+    writePartitions(basePath, 2, 0.5, false);
+
+    BOOST_CHECK_EQUAL(Opm::mergeDistributedRestart(basePath), 2);
+
+    Opm::EclIO::ERst rst(basePath + ".UNRST");
+    BOOST_CHECK(rst.hasReportStepNumber(0));
+
+    // the report step without partition data is unchanged
+    const std::vector<std::string> initial {"INTEHEAD", "LOGIHEAD", "DOUBHEAD", "STARTSOL",
+                                            "OPMEXTRA", "ENDSOL"};
+    const auto initialNames = arrayNames(rst, 0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(initialNames.begin(), initialNames.end(),
+                                  initial.begin(), initial.end());
+
+    // the cell arrays are in front of the other solution arrays, the
+    // auxiliary arrays follow ENDSOL, and the summary array is skipped
+    const std::vector<std::string> merged {"INTEHEAD", "LOGIHEAD", "DOUBHEAD", "STARTSOL",
+                                           "PRESSURE", "SWAT", "SOMAX", "OPMEXTRA",
+                                           "ENDSOL", "KRO"};
+    for (int reportStep = 1; reportStep < 3; ++reportStep) {
+        const auto names = arrayNames(rst, reportStep);
+        BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(), merged.begin(), merged.end());
+        checkMergedStep(rst, reportStep, 0.5*(reportStep - 1));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MergeIntoSeparateRestartFiles)
+{
+    TempDir dir("drst_separate");
+    const std::string basePath = (dir.path / "CASE").string();
+
+    {
+        Opm::EclIO::EclOutput output(basePath + ".X0001", false);
+        writeRestartStep(output, 1);
+    }
+    writePartitions(basePath, 1, 0.0, true);
+
+    BOOST_CHECK_EQUAL(Opm::mergeDistributedRestart(basePath, 2), 1);
+
+    Opm::EclIO::ERst rst(basePath + ".X0001");
+    BOOST_REQUIRE(rst.hasReportStepNumber(1));
+    checkMergedStep(rst, 1, 0.0);
+
+    // ECLIPSE compatible restart files do not have the auxiliary arrays
+    const auto names = arrayNames(rst, 1);
+    BOOST_CHECK(std::find(names.begin(), names.end(), "KRO") == names.end());
+    BOOST_CHECK_EQUAL(names.back(), "ENDSOL");
+}
+
+BOOST_AUTO_TEST_CASE(MismatchedPartitions)
+{
+    TempDir dir("drst_mismatch");
+    const std::string basePath = (dir.path / "CASE").string();
+
+    {
+        Opm::EclIO::EclOutput output(basePath + ".UNRST", false);
+        for (int reportStep = 1; reportStep < 3; ++reportStep)
+            writeRestartStep(output, reportStep);
+    }
+
+    writePartitions(basePath, 1, 0.0, false);
+    // Only rank 0 writes the second step
+    Opm::data::Solution sol;
+    sol.insert("SWAT", Opm::UnitSystem::measure::identity,
+               {0.0}, Opm::data::TargetType::RESTART_SOLUTION);
+    Opm::writeDistributedRestartStep(Opm::distributedRestartFileName(basePath, 0),
+                                     true, 2, 4, {0}, {0}, sol,
+                                     Opm::UnitSystem::newMETRIC(), false, false);
+
+    BOOST_CHECK_THROW(Opm::mergeDistributedRestart(basePath), std::runtime_error);
+    BOOST_CHECK_THROW(Opm::mergeDistributedRestart(basePath + "_MISSING"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(IncompletePartitions)
+{
+    TempDir dir("drst_incomplete");
+    const std::string basePath = (dir.path / "CASE").string();
+
+    {
+        Opm::EclIO::EclOutput output(basePath + ".UNRST", false);
+        writeRestartStep(output, 1);
+    }
+
+    // global cell 3 is in no partition
+    writePartitions(basePath, 1, 0.0, false);
+    Opm::data::Solution sol;
+    sol.insert("SWAT", Opm::UnitSystem::measure::identity,
+               {0.1}, Opm::data::TargetType::RESTART_SOLUTION);
+    Opm::writeDistributedRestartStep(Opm::distributedRestartFileName(basePath, 1),
+                                     false, 1, 4, {0}, {1}, sol,
+                                     Opm::UnitSystem::newMETRIC(), false, false);
+    BOOST_CHECK_THROW(Opm::mergeDistributedRestart(basePath), std::runtime_error);
+
+    // the restart file does not have the report step
+    writePartitions(basePath, 1, 0.0, false);
+    writePartitions(basePath, 2, 0.0, false);
+    BOOST_CHECK_THROW(Opm::mergeDistributedRestart(basePath), std::runtime_error);
+}
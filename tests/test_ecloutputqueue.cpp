@@ -0,0 +1,104 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE EclOutputQueueTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <ebos/ecloutputqueue.hh>
+
+#include <chrono>
+#include <future>
+
+namespace {
+
+// Long enough for a request that is not blocked to be admitted.
+const auto blockedTimeout = std::chrono::milliseconds(100);
+const auto admittedTimeout = std::chrono::seconds(30);
+
+std::future<void> acquireAsync(Opm::EclOutputQueue& queue, std::size_t bytes)
+{
+    return std::async(std::launch::async, [&queue, bytes]() { queue.acquire(bytes); });
+}
+
+bool isBlocked(const std::future<void>& request)
+{
+    return request.wait_for(blockedTimeout) == std::future_status::timeout;
+}
+
+bool isAdmitted(const std::future<void>& request)
+{
+    return request.wait_for(admittedTimeout) == std::future_status::ready;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(BlocksWhenFull)
+{
+    Opm::EclOutputQueue queue(/*maxSize=*/2, /*maxBytes=*/1000);
+    queue.acquire(10);
+    queue.acquire(10);
+
+    auto third = acquireAsync(queue, 10);
+    BOOST_CHECK(isBlocked(third));
+
+    queue.release(10);
+    BOOST_CHECK(isAdmitted(third));
+
+    queue.release(10);
+    queue.release(10);
+}
+
+BOOST_AUTO_TEST_CASE(BlocksWhenBudgetIsExhausted)
+{
+    Opm::EclOutputQueue queue(/*maxSize=*/10, /*maxBytes=*/100);
+    queue.acquire(60);
+    queue.acquire(40);
+
+    // There is room for more requests, but not for more bytes.
+    auto next = acquireAsync(queue, 1);
+    BOOST_CHECK(isBlocked(next));
+
+    queue.release(40);
+    BOOST_CHECK(isAdmitted(next));
+
+    queue.release(60);
+    queue.release(1);
+}
+
+BOOST_AUTO_TEST_CASE(AdmitsOversizedRequestWhenEmpty)
+{
+    Opm::EclOutputQueue queue(/*maxSize=*/10, /*maxBytes=*/100);
+    queue.acquire(10);
+
+    // A request larger than the whole budget waits for the queue to drain ...
+    auto oversized = acquireAsync(queue, 500);
+    BOOST_CHECK(isBlocked(oversized));
+
+    // ... and is then admitted alone.
+    queue.release(10);
+    BOOST_CHECK(isAdmitted(oversized));
+
+    auto next = acquireAsync(queue, 10);
+    BOOST_CHECK(isBlocked(next));
+
+    queue.release(500);
+    BOOST_CHECK(isAdmitted(next));
+    queue.release(10);
+}
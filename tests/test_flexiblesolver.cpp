@@ -28,6 +28,7 @@
 #if DUNE_VERSION_NEWER(DUNE_ISTL, 2, 6) && \
     BOOST_VERSION / 100 % 1000 > 48
 
+#include <opm/simulators/linalg/BinaryLinearSystem.hpp>
 #include <opm/simulators/linalg/FlexibleSolver.hpp>
 #include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
 #include <opm/simulators/linalg/PropertyTree.hpp>
@@ -36,8 +37,11 @@
 #include <dune/istl/bcrsmatrix.hh>
 #include <dune/istl/matrixmarket.hh>
 
+#include "MatrixMarketTestHelpers.hpp"
+
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 
 template <int bz>
@@ -47,21 +51,8 @@ testSolver(const Opm::PropertyTree& prm, const std::string& matrix_filename, con
     using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
     using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
     Matrix matrix;
-    {
-        std::ifstream mfile(matrix_filename);
-        if (!mfile) {
-            throw std::runtime_error("Could not read matrix file");
-        }
-        readMatrixMarket(matrix, mfile);
-    }
     Vector rhs;
-    {
-        std::ifstream rhsfile(rhs_filename);
-        if (!rhsfile) {
-            throw std::runtime_error("Could not read rhs file");
-        }
-        readMatrixMarket(rhs, rhsfile);
-    }
+    readSystem(matrix_filename, rhs_filename, matrix, rhs);
     bool transpose = false;
 
     if(prm.get<std::string>("preconditioner.type") == "cprt"){
@@ -123,6 +114,123 @@ BOOST_AUTO_TEST_CASE(TestFlexibleSolver)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestPipelinedBiCGSTABSolver)
+{
+    Opm::PropertyTree prm("options_flexiblesolver_simple.json");
+    prm.put("solver", std::string("pipelined_bicgstab"));
+    prm.put("preconditioner.type", std::string("ILU0"));
+
+    const int bz = 3;
+    auto sol = testSolver<bz>(prm, "matr33.txt", "rhs3.txt");
+    Dune::BlockVector<Dune::FieldVector<double, bz>> expected {{-1.62493, -1.76435e-06, 1.86991e-10},
+                                                               {-458.542, 2.28308e-06, -2.45341e-07},
+                                                               {-1.48005, -5.02264e-07, -1.049e-05}};
+    BOOST_REQUIRE_EQUAL(sol.size(), expected.size());
+    for (size_t i = 0; i < sol.size(); ++i) {
+        for (int row = 0; row < bz; ++row) {
+            BOOST_CHECK_CLOSE(sol[i][row], expected[i][row], 1e-3);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestRecyclingGCRSolver)
+{
+    const int bz = 3;
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+    Matrix matrix0;
+    Vector rhs;
+    readSystem("matr33.txt", "rhs3.txt", matrix0, rhs);
+
+    // Solve a sequence of systems whose values change from solve to solve,
+    // as in a Newton loop, reusing the solver and hence the recycled
+    // subspace. Every row is scaled by its own factor, so the systems are
+    // not just multiples of each other. Returns the iterations per solve.
+    auto solveSequence = [&matrix0, &rhs](const int recycle) {
+        Opm::PropertyTree prm("options_flexiblesolver_simple.json");
+        prm.put("solver", std::string("recycling_gcr"));
+        prm.put("recycle", recycle);
+
+        Matrix matrix(matrix0);
+        auto wc = [&matrix]()
+        {
+            return Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, 1, false);
+        };
+        using SeqOperatorType = Dune::MatrixAdapter<Matrix, Vector, Vector>;
+        SeqOperatorType op(matrix);
+        Dune::FlexibleSolver<Matrix, Vector> solver(op, prm, wc, 1);
+
+        std::vector<int> iterations;
+        for (int solve = 0; solve < 4; ++solve) {
+            for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+                for (auto col = row->begin(); col != row->end(); ++col) {
+                    for (int i = 0; i < bz; ++i) {
+                        const double factor = 1.0 + 0.01 * solve * (bz * row.index() + i + 1);
+                        (*col)[i] = matrix0[row.index()][col.index()][i];
+                        (*col)[i] *= factor;
+                    }
+                }
+            }
+            solver.preconditioner().update();
+
+            Vector b(rhs);
+            Vector x(rhs.size());
+            x = 0.0;
+            Dune::InverseOperatorResult res;
+            solver.apply(x, b, res);
+            BOOST_CHECK(res.converged);
+
+            // Check the solution against the current system.
+            Vector r(rhs);
+            matrix.mmv(x, r);
+            BOOST_CHECK_SMALL(r.two_norm() / rhs.two_norm(), 1e-8);
+            iterations.push_back(res.iterations);
+        }
+        return iterations;
+    };
+
+    const auto plain = solveSequence(0);
+    const auto recycled = solveSequence(3);
+    BOOST_REQUIRE_EQUAL(plain.size(), recycled.size());
+    // Nothing is recycled in the first solve, so both do the same work.
+    BOOST_CHECK_EQUAL(recycled[0], plain[0]);
+    for (std::size_t solve = 1; solve < plain.size(); ++solve) {
+        BOOST_CHECK_LT(recycled[solve], plain[solve]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestBinaryLinearSystemRoundTrip)
+{
+    const int bz = 3;
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+    Matrix matrix;
+    Vector rhs;
+    readSystem("matr33.txt", "rhs3.txt", matrix, rhs);
+    const Vector weights = Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, 1, false);
+
+    Opm::writeBinaryLinearSystem("test_flexiblesolver_system.bin", matrix, rhs, &matrix, &weights);
+    BOOST_CHECK_EQUAL(Opm::binaryLinearSystemBlockSize("test_flexiblesolver_system.bin"), bz);
+    const auto system = Opm::readBinaryLinearSystem<bz>("test_flexiblesolver_system.bin");
+
+    BOOST_CHECK(system.hasWells);
+    BOOST_REQUIRE_EQUAL(system.matrix.N(), matrix.N());
+    BOOST_REQUIRE_EQUAL(system.matrix.nonzeroes(), matrix.nonzeroes());
+    for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            BOOST_REQUIRE(system.matrix.exists(row.index(), col.index()));
+            BOOST_CHECK(system.matrix[row.index()][col.index()] == *col);
+            BOOST_CHECK(system.wells[row.index()][col.index()] == *col);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(system.rhs.size(), rhs.size());
+    BOOST_REQUIRE_EQUAL(system.weights.size(), weights.size());
+    for (size_t i = 0; i < rhs.size(); ++i) {
+        BOOST_CHECK(system.rhs[i] == rhs[i]);
+        BOOST_CHECK(system.weights[i] == weights[i]);
+    }
+}
+
 #else
 
 // Do nothing if we do not have at least Dune 2.6.
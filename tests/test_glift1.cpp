@@ -96,6 +96,28 @@ initSimulator(const char *filename)
 
 namespace {
 
+// Gives the test access to the rate computations of the gas lift
+// optimization, with and without the per-ALQ cache.
+template <class TypeTag>
+class GasLiftSingleWellTest : public Opm::GasLiftSingleWell<TypeTag>
+{
+    using Base = Opm::GasLiftSingleWell<TypeTag>;
+
+public:
+    using Base::Base;
+    using Opm::GasLiftSingleWellGeneric::computeWellRatesWithALQ_;
+
+    std::optional<std::vector<double>> computeUncachedWellRates(double alq) const
+    {
+        std::optional<std::vector<double>> potentials;
+        if (auto bhp = this->computeBhpAtThpLimit_(alq)) {
+            potentials.emplace(this->num_phases_, 0.0);
+            this->computeWellRates_(this->getBhpWithLimit_(*bhp).first, *potentials);
+        }
+        return potentials;
+    }
+};
+
 struct GliftFixture {
     GliftFixture() {
     int argc = boost::unit_test::framework::master_test_suite().argc;
@@ -196,3 +218,69 @@ BOOST_AUTO_TEST_CASE(G1)
     BOOST_CHECK(!state->increase().has_value());
 }
 
+
+BOOST_AUTO_TEST_CASE(G1CachedRates)
+{
+    using TypeTag = Opm::Properties::TTag::TestGliftTypeTag;
+    using WellModel = Opm::BlackoilWellModel<TypeTag>;
+    using StdWell = Opm::StandardWell<TypeTag>;
+    using GasLiftGroupInfo = Opm::GasLiftGroupInfo;
+    using GLiftEclWells = typename GasLiftGroupInfo::GLiftEclWells;
+    using GLiftSyncGroups = typename Opm::GasLiftSingleWellGeneric::GLiftSyncGroups;
+
+    auto simulator = initSimulator<TypeTag>("GLIFT1.DATA");
+
+    simulator->model().applyInitialSolution();
+    simulator->setEpisodeIndex(-1);
+    simulator->setEpisodeLength(0.0);
+    simulator->startNextEpisode(/*episodeStartTime=*/0.0, /*episodeLength=*/1e30);
+    simulator->setTimeStepSize(43200);  // 12 hours
+    simulator->model().newtonMethod().setIterationIndex(0);
+    WellModel& well_model = simulator->problem().wellModel();
+    well_model.beginReportStep(/*report_step_idx=*/0);
+    well_model.beginTimeStep();
+    well_model.updatePerforationIntensiveQuantities();
+    Opm::DeferredLogger deferred_logger;
+    well_model.calculateExplicitQuantities(deferred_logger);
+    well_model.prepareTimeStep(deferred_logger);
+    well_model.updateWellControls(deferred_logger, /* check group controls */ true);
+    well_model.initPrimaryVariablesEvaluation();
+    const StdWell *std_well = dynamic_cast<const StdWell *>(well_model.getWell("B-1H").get());
+    BOOST_REQUIRE(std_well != nullptr);
+
+    const auto& summary_state = simulator->vanguard().summaryState();
+    GLiftEclWells ecl_well_map;
+    well_model.initGliftEclWellMap(ecl_well_map);
+    GasLiftGroupInfo group_info {
+        ecl_well_map,
+        simulator->vanguard().schedule(),
+        summary_state,
+        simulator->episodeIndex(),
+        simulator->model().newtonMethod().numIterations(),
+        well_model.phaseUsage(),
+        deferred_logger,
+        well_model.wellState(),
+        simulator->vanguard().grid().comm()
+    };
+    GLiftSyncGroups sync_groups;
+    GasLiftSingleWellTest<TypeTag> glift {*std_well, *(simulator.get()), summary_state,
+        deferred_logger, well_model.wellState(), well_model.groupState(), group_info, sync_groups};
+    group_info.initialize();
+
+    // The first call for an ALQ value fills the cache, the second one is
+    // answered from it. Both must agree with the computation without cache.
+    const double alq_increment = 12500.0 / 86400.0;  // LIFTOPT item 1, in SI units
+    for (const double alq : {0.0, alq_increment, 2*alq_increment}) {
+        const auto uncached = glift.computeUncachedWellRates(alq);
+        const auto first = glift.computeWellRatesWithALQ_(alq);
+        const auto cached = glift.computeWellRatesWithALQ_(alq);
+        BOOST_REQUIRE_EQUAL(uncached.has_value(), first.has_value());
+        BOOST_REQUIRE_EQUAL(uncached.has_value(), cached.has_value());
+        if (uncached) {
+            BOOST_CHECK_EQUAL_COLLECTIONS(uncached->begin(), uncached->end(),
+                                          first->begin(), first->end());
+            BOOST_CHECK_EQUAL_COLLECTIONS(uncached->begin(), uncached->end(),
+                                          cached->begin(), cached->end());
+        }
+    }
+}
@@ -401,6 +401,15 @@ BOOST_AUTO_TEST_CASE(PartialSumParallel)
         auto gi = comm.rank() + comm.size() * i;
         BOOST_CHECK(localCurrent[i]==globalPartialSum[gi]);
     }
+
+    // The exchange set up by endReset is reused for new values.
+    std::vector<double> localOnes(localCurrent.size(), 1.0);
+    commAboveBelow.partialSumPerfValues(std::begin(localOnes), std::end(localOnes));
+    for (std::size_t i = 0; i < localOnes.size(); ++i)
+    {
+        auto gi = comm.rank() + comm.size() * i;
+        BOOST_CHECK_EQUAL(localOnes[i], gi + 1.0);
+    }
 }
 
 void testGlobalPerfFactoryParallel(int num_component, bool local_consecutive = false)
@@ -38,6 +38,8 @@
 #include <dune/istl/matrixmarket.hh>
 #include <dune/istl/solvers.hh>
 
+#include "MatrixMarketTestHelpers.hpp"
+
 #include <fstream>
 #include <iostream>
 
@@ -73,21 +75,8 @@ testPrec(const Opm::PropertyTree& prm, const std::string& matrix_filename, const
     using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
     using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
     Matrix matrix;
-    {
-        std::ifstream mfile(matrix_filename);
-        if (!mfile) {
-            throw std::runtime_error("Could not read matrix file");
-        }
-        readMatrixMarket(matrix, mfile);
-    }
     Vector rhs;
-    {
-        std::ifstream rhsfile(rhs_filename);
-        if (!rhsfile) {
-            throw std::runtime_error("Could not read rhs file");
-        }
-        readMatrixMarket(rhs, rhsfile);
-    }
+    readSystem(matrix_filename, rhs_filename, matrix, rhs);
     using Operator = Dune::MatrixAdapter<Matrix, Vector, Vector>;
     Operator op(matrix);
     using PrecFactory = Opm::PreconditionerFactory<Operator>;
@@ -160,6 +149,119 @@ BOOST_AUTO_TEST_CASE(TestDefaultPreconditionerFactory)
 }
 
 
+BOOST_AUTO_TEST_CASE(TestThreadedILU0Preconditioner)
+{
+    // Read parameters.
+    Opm::PropertyTree prm("options_flexiblesolver_simple.json");
+    prm.put("preconditioner.type", std::string("ThreadedILU0"));
+
+    // Test with 1x1 block solvers.
+    test1(prm);
+
+    // Test with 3x3 block solvers.
+    test3(prm);
+
+    // Level scheduling can also be requested for the standard ILU0.
+    prm.put("preconditioner.type", std::string("ParOverILU0"));
+    prm.put("preconditioner.level_scheduling", std::string("true"));
+    test1(prm);
+    test3(prm);
+}
+
+
+BOOST_AUTO_TEST_CASE(TestMixedPrecisionPreconditioner)
+{
+    // Read parameters.
+    Opm::PropertyTree prm("options_flexiblesolver_simple.json");
+    prm.put("preconditioner.mixed_precision", true);
+
+    // The Krylov solver still converges to the double precision solution.
+    prm.put("preconditioner.type", std::string("ParOverILU0"));
+    test1(prm);
+    test3(prm);
+
+    prm.put("preconditioner.type", std::string("amg"));
+    test1(prm);
+    test3(prm);
+}
+
+
+BOOST_AUTO_TEST_CASE(TestCprNumericOnlyUpdate)
+{
+    // Read parameters.
+    Opm::PropertyTree prm("options_flexiblesolver.json");
+    prm.put("preconditioner.update_numeric_only", true);
+    prm.put("preconditioner.verbosity", 0);
+
+    const int bz = 3;
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+    using Operator = Dune::MatrixAdapter<Matrix, Vector, Vector>;
+    using PrecFactory = Opm::PreconditionerFactory<Operator>;
+    Matrix matrix;
+    Vector rhs;
+    readSystem("matr33.txt", "rhs3.txt", matrix, rhs);
+    Operator op(matrix);
+    auto wc = [&matrix]()
+    {
+        return Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, 1, false);
+    };
+    auto updated = PrecFactory::create(op, prm.get_child("preconditioner"), wc, 1);
+    auto stale = PrecFactory::create(op, prm.get_child("preconditioner"), wc, 1);
+
+    // Change the values, but not the sparsity pattern, by a different
+    // factor for every block row and for the diagonal blocks, such that
+    // neither the preconditioner nor the solution is just scaled.
+    for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            *col *= 1.0 + 0.5*row.index() + (col.index() == row.index() ? 0.25 : 0.0);
+        }
+    }
+    updated->update();
+    auto rebuilt = PrecFactory::create(op, prm.get_child("preconditioner"), wc, 1);
+
+    auto solve = [&](Dune::Preconditioner<Vector, Vector>& prec, Dune::InverseOperatorResult& res)
+    {
+        Dune::BiCGSTABSolver<Vector> solver(op, prec, prm.get<double>("tol"), prm.get<int>("maxiter"), 0);
+        Vector x(rhs.size());
+        x = 0.0;
+        Vector b = rhs;
+        solver.apply(x, b, res);
+        return x;
+    };
+
+    // The numerically updated preconditioner behaves like a new one.
+    Dune::InverseOperatorResult updatedRes;
+    Dune::InverseOperatorResult rebuiltRes;
+    const auto updatedSol = solve(*updated, updatedRes);
+    const auto rebuiltSol = solve(*rebuilt, rebuiltRes);
+    BOOST_CHECK_EQUAL(updatedRes.iterations, rebuiltRes.iterations);
+    BOOST_REQUIRE_EQUAL(updatedSol.size(), rebuiltSol.size());
+    for (size_t i = 0; i < updatedSol.size(); ++i) {
+        for (int row = 0; row < bz; ++row) {
+            BOOST_CHECK_CLOSE(updatedSol[i][row], rebuiltSol[i][row], 1e-8);
+        }
+    }
+
+    // The preconditioner which is not updated does not.
+    Vector updatedApply(rhs.size());
+    Vector rebuiltApply(rhs.size());
+    Vector staleApply(rhs.size());
+    updatedApply = 0.0;
+    rebuiltApply = 0.0;
+    staleApply = 0.0;
+    updated->apply(updatedApply, rhs);
+    rebuilt->apply(rebuiltApply, rhs);
+    stale->apply(staleApply, rhs);
+    Vector diff = updatedApply;
+    diff -= rebuiltApply;
+    BOOST_CHECK_SMALL(diff.two_norm(), 1e-10 * rebuiltApply.two_norm());
+    diff = staleApply;
+    diff -= rebuiltApply;
+    BOOST_CHECK_GT(diff.two_norm(), 1e-3 * rebuiltApply.two_norm());
+}
+
+
 template <int bz>
 using M = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
 template <int bz>
@@ -0,0 +1,135 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media Project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE SegmentTreeSolverTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/wells/SegmentTreeSolver.hpp>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+constexpr int bs = 4;
+using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bs, bs>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, bs>>;
+
+// A segment matrix with the given outlets (-1 for the top segment), with
+// the pattern set up as in MultisegmentWellEval::initMatrixAndVectors().
+Matrix segmentMatrix(const std::vector<int>& outlets)
+{
+    const int n = outlets.size();
+    std::vector<std::vector<int>> inlets(n);
+    int nnz = n;
+    for (int seg = 0; seg < n; ++seg) {
+        if (outlets[seg] >= 0) {
+            inlets[outlets[seg]].push_back(seg);
+            nnz += 2;
+        }
+    }
+    Matrix D(n, n, nnz, Matrix::row_wise);
+    for (auto row = D.createbegin(); row != D.createend(); ++row) {
+        const int seg = row.index();
+        if (outlets[seg] >= 0) {
+            row.insert(outlets[seg]);
+        }
+        row.insert(seg);
+        for (const int inlet : inlets[seg]) {
+            row.insert(inlet);
+        }
+    }
+    double value = 0.1;
+    for (auto row = D.begin(); row != D.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            for (int i = 0; i < bs; ++i) {
+                for (int j = 0; j < bs; ++j) {
+                    value = value * 1.7 - static_cast<int>(value * 1.7);
+                    (*col)[i][j] = value - 0.5 + (row.index() == col.index() && i == j ? 10.0 : 0.0);
+                }
+            }
+        }
+    }
+    return D;
+}
+
+void checkSolve(const std::vector<int>& outlets)
+{
+    const Matrix D = segmentMatrix(outlets);
+    auto tree = std::make_shared<const Opm::mswellhelpers::SegmentTree>(D);
+    const Opm::mswellhelpers::SegmentTreeSolver<Matrix> solver(tree, D);
+
+    Vector b(D.N());
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        for (int j = 0; j < bs; ++j) {
+            b[i][j] = 1.0 + i - 0.3 * j;
+        }
+    }
+    Vector x;
+    solver.apply(x, b);
+
+    Vector r(b);
+    D.mmv(x, r);
+    BOOST_CHECK_SMALL(r.infinity_norm(), 1e-10 * b.infinity_norm());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SingleSegment)
+{
+    checkSolve({-1});
+}
+
+BOOST_AUTO_TEST_CASE(Tubing)
+{
+    // 0 <- 1 <- 2 <- ... <- 9, i.e. block tridiagonal
+    std::vector<int> outlets {-1};
+    for (int seg = 1; seg < 10; ++seg) {
+        outlets.push_back(seg - 1);
+    }
+    checkSolve(outlets);
+}
+
+BOOST_AUTO_TEST_CASE(BranchedWell)
+{
+    // A main bore 0-1-2-8-3 with a lateral 4-5 from segment 1 and a
+    // lateral 6-7 from segment 2, numbered out of tree order.
+    checkSolve({-1, 0, 1, 8, 1, 4, 2, 6, 2});
+}
+
+BOOST_AUTO_TEST_CASE(NotATree)
+{
+    // A loop 0-1-2-0 cannot come from a segment set.
+    Matrix D(3, 3, 9, Matrix::row_wise);
+    for (auto row = D.createbegin(); row != D.createend(); ++row) {
+        for (int col = 0; col < 3; ++col) {
+            row.insert(col);
+        }
+    }
+    BOOST_CHECK_THROW(Opm::mswellhelpers::SegmentTree tree(D), std::logic_error);
+}
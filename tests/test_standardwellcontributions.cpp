@@ -0,0 +1,152 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media Project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE StandardWellContributionsTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/wells/StandardWellContributions.hpp>
+
+#include <dune/common/dynmatrix.hh>
+#include <dune/common/dynvector.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <vector>
+
+namespace
+{
+
+constexpr int numEq = 3;
+constexpr int numWellEq = 4;
+
+using BVector = Dune::BlockVector<Dune::FieldVector<double, numEq>>;
+using BVectorWell = Dune::BlockVector<Dune::DynamicVector<double>>;
+using OffDiagMatWell = Dune::BCRSMatrix<Dune::DynamicMatrix<double>>;
+using DiagMatWell = Dune::BCRSMatrix<Dune::DynamicMatrix<double>>;
+
+// The matrices of a StandardWell perforating the given cells, with
+// arbitrary but reproducible values.
+struct Well
+{
+    Well(const std::vector<int>& cells, const int numCells, const double seed)
+    {
+        B.setSize(1, numCells, cells.size());
+        C.setSize(1, numCells, cells.size());
+        for (auto* m : {&B, &C}) {
+            for (auto row = m->createbegin(); row != m->createend(); ++row) {
+                for (const int cell : cells) {
+                    row.insert(cell);
+                }
+            }
+        }
+        invD.setSize(1, 1, 1);
+        for (auto row = invD.createbegin(); row != invD.createend(); ++row) {
+            row.insert(0);
+        }
+
+        double value = seed;
+        for (auto* m : {&B, &C}) {
+            for (auto col = (*m)[0].begin(); col != (*m)[0].end(); ++col) {
+                col->resize(numWellEq, numEq);
+                for (int i = 0; i < numWellEq; ++i) {
+                    for (int j = 0; j < numEq; ++j) {
+                        (*col)[i][j] = (value += 0.37) - 3.0 * (i == j);
+                    }
+                }
+            }
+        }
+        invD[0][0].resize(numWellEq, numWellEq);
+        for (int i = 0; i < numWellEq; ++i) {
+            for (int j = 0; j < numWellEq; ++j) {
+                invD[0][0][i][j] = (i == j ? 2.0 : 0.1 * (i - j)) + seed;
+            }
+        }
+    }
+
+    // Ax = Ax - alpha C^T D^-1 B x, as in StandardWell::applyScaleAdd()
+    void applyScaleAdd(const double alpha, const BVector& x, BVector& Ax) const
+    {
+        BVectorWell Bx(1);
+        Bx[0].resize(numWellEq);
+        BVectorWell invDBx(Bx);
+        B.mv(x, Bx);
+        invD.mv(Bx, invDBx);
+        invDBx *= alpha;
+        C.mmtv(invDBx, Ax);
+    }
+
+    OffDiagMatWell B;
+    OffDiagMatWell C;
+    DiagMatWell invD;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(BatchedApplyMatchesPerWellApply)
+{
+    const int numCells = 10;
+    const std::vector<Well> wells {
+        Well({0, 3, 4}, numCells, 0.5),
+        Well({7}, numCells, -1.0),
+        Well({2, 3, 8, 9}, numCells, 0.25),
+    };
+
+    Opm::StandardWellContributions<double, numEq, numWellEq> contribs;
+    for (const auto& well : wells) {
+        contribs.addWell(well.B[0], well.C[0], well.invD[0][0]);
+    }
+    BOOST_CHECK_EQUAL(contribs.numWells(), wells.size());
+
+    BVector x(numCells);
+    BVector y(numCells);
+    for (int i = 0; i < numCells; ++i) {
+        for (int j = 0; j < numEq; ++j) {
+            x[i][j] = 1.0 + i - 0.5 * j;
+            y[i][j] = 0.1 * (i + j);
+        }
+    }
+    BVector expected(y);
+
+    const double alpha = -0.7;
+    for (const auto& well : wells) {
+        well.applyScaleAdd(alpha, x, expected);
+    }
+    contribs.applyScaleAdd(alpha, x, y);
+
+    for (int i = 0; i < numCells; ++i) {
+        for (int j = 0; j < numEq; ++j) {
+            BOOST_CHECK_CLOSE(y[i][j], expected[i][j], 1e-12);
+        }
+    }
+
+    // Cells without perforations must not be touched.
+    BOOST_CHECK_EQUAL(y[1][0], 0.1);
+    BOOST_CHECK_EQUAL(y[5][2], 0.1 * 7);
+
+    contribs.clear();
+    BOOST_CHECK(contribs.empty());
+    BVector z(y);
+    contribs.applyScaleAdd(alpha, x, z);
+    for (int i = 0; i < numCells; ++i) {
+        BOOST_CHECK(z[i] == y[i]);
+    }
+}
@@ -0,0 +1,122 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestThreadedForEach
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/DeferredLogger.hpp>
+#include <opm/simulators/utils/threadedForEach.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/OpmLog/StreamLog.hpp>
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Opm;
+
+namespace {
+
+std::string logged(DeferredLogger& deferred_logger)
+{
+    std::ostringstream log_stream;
+    OpmLog::removeAllBackends();
+    OpmLog::addBackend("STREAM", std::make_shared<StreamLog>(log_stream, Log::DefaultMessageTypes));
+    deferred_logger.logMessages();
+    OpmLog::removeAllBackends();
+    return log_stream.str();
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(LogsInIndexOrder)
+{
+    const int n = 100;
+    std::vector<int> calls(n, 0);
+    DeferredLogger deferred_logger;
+    threadedForEach(n, [&calls](const int i, DeferredLogger& logger) {
+        ++calls[i];
+        logger.info("first " + std::to_string(i));
+        logger.info("second " + std::to_string(i));
+    }, [](const int i) { return i % 7 == 0; }, deferred_logger);
+
+    DeferredLogger expected;
+    for (int i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(calls[i], 1);
+        expected.info("first " + std::to_string(i));
+        expected.info("second " + std::to_string(i));
+    }
+    BOOST_CHECK_EQUAL(logged(deferred_logger), logged(expected));
+}
+
+BOOST_AUTO_TEST_CASE(ProcessesSerialIndicesAfterTheOthers)
+{
+    const int n = 50;
+    std::vector<int> serial_order;
+    std::vector<int> calls(n, 0);
+    DeferredLogger deferred_logger;
+    threadedForEach(n, [&](const int i, DeferredLogger&) {
+        if (i % 10 == 3) {
+            // The serial indices must all see the threaded ones done.
+            for (int j = 0; j < n; ++j) {
+                if (j % 10 != 3) {
+                    BOOST_CHECK_EQUAL(calls[j], 1);
+                }
+            }
+            serial_order.push_back(i);
+        }
+        ++calls[i];
+    }, [](const int i) { return i % 10 == 3; }, deferred_logger);
+
+    const std::vector<int> expected {3, 13, 23, 33, 43};
+    BOOST_CHECK_EQUAL_COLLECTIONS(serial_order.begin(), serial_order.end(),
+                                  expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(RethrowsFirstException)
+{
+    const int n = 20;
+    std::vector<int> calls(n, 0);
+    DeferredLogger deferred_logger;
+    try {
+        threadedForEach(n, [&calls](const int i, DeferredLogger& logger) {
+            ++calls[i];
+            logger.info("index " + std::to_string(i));
+            if (i == 5 || i == 15) {
+                throw std::runtime_error("failed at " + std::to_string(i));
+            }
+        }, deferred_logger);
+        BOOST_FAIL("No exception thrown");
+    } catch (const std::runtime_error& e) {
+        BOOST_CHECK_EQUAL(std::string(e.what()), "failed at 5");
+    }
+
+    // All indices are still processed and their messages kept.
+    DeferredLogger expected;
+    for (int i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(calls[i], 1);
+        expected.info("index " + std::to_string(i));
+    }
+    BOOST_CHECK_EQUAL(logged(deferred_logger), logged(expected));
+}
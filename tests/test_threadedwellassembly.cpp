@@ -0,0 +1,191 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+#include "config.h"
+
+#define BOOST_TEST_MODULE ThreadedWellAssembly
+
+#include <opm/models/utils/propertysystem.hh>
+#include <opm/models/utils/parametersystem.hh>
+#include <ebos/eclproblem.hh>
+#include <ebos/ebos.hh>
+#include <opm/models/utils/start.hh>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/OpmLog/StreamLog.hpp>
+#include <opm/simulators/wells/BlackoilWellModel.hpp>
+#include <opm/simulators/wells/MultisegmentWell.hpp>
+#include <opm/simulators/wells/WellState.hpp>
+
+#if HAVE_DUNE_FEM
+#include <dune/fem/misc/mpimanager.hh>
+#else
+#include <dune/common/parallel/mpihelper.hh>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+namespace Opm::Properties {
+    namespace TTag {
+        struct TestThreadedWellAssemblyTypeTag {
+            using InheritsFrom = std::tuple<EbosTypeTag>;
+        };
+    }
+}
+
+template <class TypeTag>
+std::unique_ptr<Opm::GetPropType<TypeTag, Opm::Properties::Simulator>>
+initSimulator(const char *filename)
+{
+    using Simulator = Opm::GetPropType<TypeTag, Opm::Properties::Simulator>;
+
+    std::string filename_arg = "--ecl-deck-file-name=";
+    filename_arg += filename;
+
+    const char* argv[] = {
+        "test_threadedwellassembly",
+        filename_arg.c_str()
+    };
+
+    Opm::setupParameters_<TypeTag>(/*argc=*/sizeof(argv)/sizeof(argv[0]), argv, /*registerParams=*/false);
+
+    return std::unique_ptr<Simulator>(new Simulator);
+}
+
+namespace {
+
+struct ThreadedWellAssemblyFixture {
+    ThreadedWellAssemblyFixture() {
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char** argv = boost::unit_test::framework::master_test_suite().argv;
+#if HAVE_DUNE_FEM
+    Dune::Fem::MPIManager::initialize(argc, argv);
+#else
+    Dune::MPIHelper::instance(argc, argv);
+#endif
+        using TypeTag = Opm::Properties::TTag::TestThreadedWellAssemblyTypeTag;
+        Opm::registerAllParameters_<TypeTag>();
+    }
+};
+
+// Everything the well assembly produces that must not depend on the number
+// of threads.
+struct AssemblyResult {
+    std::vector<double> well_contributions;
+    std::vector<double> bhp;
+    std::vector<double> rates;
+    std::vector<double> segment_pressures;
+    std::vector<double> segment_rates;
+    std::string log;
+};
+
+AssemblyResult assembleWells(const int num_threads)
+{
+    using TypeTag = Opm::Properties::TTag::TestThreadedWellAssemblyTypeTag;
+    using WellModel = Opm::BlackoilWellModel<TypeTag>;
+    using MSWell = Opm::MultisegmentWell<TypeTag>;
+
+#ifdef _OPENMP
+    omp_set_num_threads(num_threads);
+#else
+    static_cast<void>(num_threads);
+#endif
+
+    std::ostringstream log_stream;
+    Opm::OpmLog::removeAllBackends();
+    Opm::OpmLog::addBackend("STREAM", std::make_shared<Opm::StreamLog>(log_stream, Opm::Log::DefaultMessageTypes));
+
+    // msw.data has a water injector and a multisegment producer on BHP
+    // control, so the assembly runs the producer's operability check.
+    auto simulator = initSimulator<TypeTag>("msw.data");
+    simulator->model().applyInitialSolution();
+    simulator->setEpisodeIndex(-1);
+    simulator->setEpisodeLength(0.0);
+    simulator->startNextEpisode(/*episodeStartTime=*/0.0, /*episodeLength=*/1e30);
+    simulator->setTimeStepSize(86400);
+    simulator->model().newtonMethod().setIterationIndex(0);
+
+    WellModel& well_model = simulator->problem().wellModel();
+    well_model.beginReportStep(0);
+    well_model.beginTimeStep();
+    well_model.beginIteration();
+
+    BOOST_CHECK(dynamic_cast<MSWell*>(well_model.getWell("PROD01").get()) != nullptr);
+
+    AssemblyResult result;
+
+    typename WellModel::BVector r(simulator->model().numGridDof());
+    r = 0.0;
+    well_model.apply(r);
+    for (const auto& block : r) {
+        result.well_contributions.insert(result.well_contributions.end(), block.begin(), block.end());
+    }
+
+    const auto& well_state = well_model.wellState();
+    for (std::size_t w = 0; w < well_state.size(); ++w) {
+        result.bhp.push_back(well_state.bhp(w));
+        const auto rates = well_state.wellRates(w);
+        result.rates.insert(result.rates.end(), rates.begin(), rates.end());
+        const auto& segments = well_state.segments(w);
+        result.segment_pressures.insert(result.segment_pressures.end(),
+                                        segments.pressure.begin(), segments.pressure.end());
+        result.segment_rates.insert(result.segment_rates.end(),
+                                    segments.rates.begin(), segments.rates.end());
+    }
+
+    Opm::OpmLog::removeAllBackends();
+    result.log = log_stream.str();
+    return result;
+}
+
+}
+
+BOOST_GLOBAL_FIXTURE(ThreadedWellAssemblyFixture);
+
+BOOST_AUTO_TEST_CASE(ThreadedAssemblyMatchesSerial)
+{
+    const auto serial = assembleWells(1);
+    const auto threaded = assembleWells(4);
+
+    // Every well is assembled by one thread either way, so the results are
+    // expected to be bitwise identical and not just close.
+    BOOST_CHECK_EQUAL_COLLECTIONS(serial.well_contributions.begin(), serial.well_contributions.end(),
+                                  threaded.well_contributions.begin(), threaded.well_contributions.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(serial.bhp.begin(), serial.bhp.end(),
+                                  threaded.bhp.begin(), threaded.bhp.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(serial.rates.begin(), serial.rates.end(),
+                                  threaded.rates.begin(), threaded.rates.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(serial.segment_pressures.begin(), serial.segment_pressures.end(),
+                                  threaded.segment_pressures.begin(), threaded.segment_pressures.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(serial.segment_rates.begin(), serial.segment_rates.end(),
+                                  threaded.segment_rates.begin(), threaded.segment_rates.end());
+    BOOST_CHECK_EQUAL(serial.log, threaded.log);
+}
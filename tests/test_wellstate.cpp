@@ -24,10 +24,13 @@
 #include "MpiFixture.hpp"
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/simulators/wells/GlobalWellInfo.hpp>
+#include <opm/simulators/wells/GroupTree.hpp>
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
+#include <opm/simulators/wells/WellGroupHelpers.hpp>
 #include <opm/simulators/wells/WellState.hpp>
 #include <opm/simulators/wells/SegmentState.hpp>
 #include <opm/simulators/wells/WellContainer.hpp>
+#include <opm/simulators/wells/WellPhaseContainer.hpp>
 #include <opm/simulators/wells/PerfData.hpp>
 #include <opm/parser/eclipse/Python/Python.hpp>
 
@@ -50,7 +53,9 @@
 
 #include <chrono>
 #include <cstddef>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 BOOST_GLOBAL_FIXTURE(MPIFixture);
 
@@ -364,6 +369,48 @@ BOOST_AUTO_TEST_CASE(STOP_well)
     }
 }
 
+BOOST_AUTO_TEST_CASE(GroupTreeSums)
+{
+    const Setup setup{ "msw.data" };
+    const auto tstep = std::size_t{0};
+
+    std::vector<Opm::ParallelWellInfo> pinfos;
+    auto wstate = buildWellState(setup, tstep, pinfos);
+    const std::size_t np = wstate.numPhases();
+    for (int well_index = 0; well_index < wstate.numWells(); ++well_index) {
+        for (std::size_t phase = 0; phase < np; ++phase) {
+            wstate.wellRates(well_index)[phase] = 10.0 * (well_index + 1) + phase;
+        }
+    }
+
+    const Opm::GroupTree tree(setup.sched, tstep);
+    BOOST_CHECK_EQUAL(tree.numGroups(), 3U);
+    BOOST_CHECK_EQUAL(tree.parent(tree.groupId("FIELD")), -1);
+    BOOST_CHECK_EQUAL(tree.parent(tree.groupId("P")), tree.groupId("FIELD"));
+    BOOST_CHECK_EQUAL(tree.groupId("NO_SUCH_GROUP"), -1);
+    BOOST_CHECK_EQUAL(tree.bottomUpOrder().back(), tree.groupId("FIELD"));
+
+    const std::vector<std::string> chain{"FIELD", "P", "PROD01"};
+    BOOST_CHECK(tree.chainTopBot("PROD01", "FIELD") == chain);
+    BOOST_CHECK(Opm::WellGroupHelpers::groupChainTopBot("PROD01", "FIELD", setup.sched, tstep, nullptr) == chain);
+    BOOST_CHECK(Opm::WellGroupHelpers::groupChainTopBot("PROD01", "FIELD", setup.sched, tstep, &tree) == chain);
+    BOOST_CHECK(Opm::WellGroupHelpers::groupChainTopBot("P", "FIELD", setup.sched, tstep, &tree)
+                == Opm::WellGroupHelpers::groupChainTopBot("P", "FIELD", setup.sched, tstep, nullptr));
+    BOOST_CHECK_THROW(tree.chainTopBot("PROD01", "I"), std::logic_error);
+
+    for (const bool injector : {false, true}) {
+        const auto sums = tree.sumWellPhaseRates(wstate.wellRates(), wstate, injector);
+        BOOST_CHECK_EQUAL(sums.size(), tree.numGroups() * np);
+        for (std::size_t group_id = 0; group_id < tree.numGroups(); ++group_id) {
+            const auto& group = setup.sched.getGroup(tree.groupName(group_id), tstep);
+            for (std::size_t phase = 0; phase < np; ++phase) {
+                const double expected = Opm::WellGroupHelpers::sumWellRates(group, setup.sched, wstate, tstep, phase, injector);
+                BOOST_CHECK_CLOSE(sums[group_id * np + phase], expected, 1.0e-10);
+            }
+        }
+    }
+}
+
 
 // ---------------------------------------------------------------------
 
@@ -494,6 +541,54 @@ BOOST_AUTO_TEST_CASE(TESTWellContainer) {
     BOOST_CHECK(!wx.has_value());
 }
 
+BOOST_AUTO_TEST_CASE(TESTWellPhaseContainer) {
+    Opm::WellPhaseContainer<double> wc;
+    BOOST_CHECK(wc.empty());
+
+    wc.add("W1", {1, 2, 3});
+    wc.add("W2", {4, 5, 6});
+    BOOST_CHECK_EQUAL(wc.size(), 2);
+    BOOST_CHECK_EQUAL(wc.num_phases(), 3);
+    BOOST_CHECK_THROW(wc.add("W1", {1, 2, 3}), std::exception);
+    BOOST_CHECK_THROW(wc.add("W3", {1, 2}), std::exception);
+
+    BOOST_CHECK_THROW(wc[10], std::exception);
+    BOOST_CHECK_THROW(wc["INVALID_WELL"], std::exception);
+    BOOST_CHECK_EQUAL(wc[1].size(), 3);
+    BOOST_CHECK_EQUAL(wc[1][0], 4);
+    BOOST_CHECK_EQUAL(wc["W1"][2], 3);
+
+    // The values are stored well by well in one array.
+    wc["W2"][1] = 50;
+    const std::vector<double> expected{1, 2, 3, 4, 50, 6};
+    BOOST_CHECK(wc.data() == expected);
+
+    Opm::WellPhaseContainer<double> wc2;
+    wc2.add("W2", {0, 0, 0});
+    wc2.add("W3", {7, 8, 9});
+    wc2.copy_welldata(wc);
+    BOOST_CHECK_EQUAL(wc2["W2"][1], 50);
+    BOOST_CHECK_EQUAL(wc2["W3"][0], 7);
+    BOOST_CHECK_THROW(wc2.copy_welldata(wc, "W3"), std::exception);
+
+    const auto& cwc = wc;
+    double sum = 0;
+    for (const auto& v : cwc[0])
+        sum += v;
+    BOOST_CHECK_EQUAL(sum, 6);
+
+    auto w2 = wc.well_index("W2");
+    BOOST_CHECK(w2.has_value());
+    BOOST_CHECK_EQUAL(w2.value(), 1);
+    BOOST_CHECK_EQUAL(wc.well_name(1), "W2");
+    BOOST_CHECK(!wc.well_index("WX").has_value());
+
+    wc.clear();
+    BOOST_CHECK(wc.empty());
+    wc.add("W1", {1, 2});
+    BOOST_CHECK_EQUAL(wc.num_phases(), 2);
+}
+
 BOOST_AUTO_TEST_CASE(TESTSegmentState) {
     const Setup setup{ "msw.data" };
     const auto& well = setup.sched.getWell("PROD01", 0);